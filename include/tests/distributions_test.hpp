@@ -0,0 +1 @@
+void distributions_test();
@@ -0,0 +1 @@
+void ziggurat_test();
@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @brief Branch-free vectorized Box-Muller normal generator.
+ *
+ * z0 = r cos(2 pi u2), z1 = r sin(2 pi u2) with r = sqrt(-2 log u1) turns 8
+ * uniforms into 8 independent standard normals with no data-dependent
+ * branch, so unlike the ziggurat all 4 lanes always do useful work. The cost
+ * is one log_ps, one sincos_ps_bounded and a square root per 8 normals, which
+ * makes it slower than the ziggurat early exit for scalar call sites but a
+ * good fit for filling arrays.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus_vectorized.hpp"
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
+#include "vexmath/functions/vectorized_trig.hpp"
+#include <cstddef>
+
+namespace math {
+namespace distributions {
+/**
+ * @class VBoxMuller
+ * @brief Vectorized normal PRN generator, 8 normals per step
+ */
+class VBoxMuller : public VXoroshiro128plus {
+  public:
+    explicit VBoxMuller(uint64_t seed)
+        : VXoroshiro128plus(seed) {}
+
+    /**
+     * @brief 8 independent standard normal PRNs
+     */
+    inline void normal8(float32x4_t* z0, float32x4_t* z1) {
+        /* u1 in (0, 1] keeps the log finite, the angle is in (-pi, pi) so
+         * that sincos_ps_bounded can skip the range reduction */
+        float32x4_t u1 = uniform_open0(next());
+        float32x4_t angle =
+          vmulq_n_f32(vsubq_f32(uniform_open(next()), vdupq_n_f32(0.5f)), 6.28318530717959f);
+
+        /* r = sqrt(-2 log u1) with Vsqrt<2>, V_rsqrt's Quake estimate would
+         * bias the variance by ~0.3% */
+        float32x4_t r = Vsqrt<2>(vmaxq_f32(vmulq_n_f32(log_ps(u1), -2), vdupq_n_f32(0)));
+
+        v4sf s, c;
+        sincos_ps_bounded(angle, &s, &c);
+        *z0 = vmulq_f32(r, c);
+        *z1 = vmulq_f32(r, s);
+    }
+
+    /**
+     * @brief Fills out with n normal PRNs with the given mean and std
+     * deviation
+     */
+    void fill(float* out, size_t n, float mean = 0, float std_deviation = 1) {
+        const float32x4_t vmean = vdupq_n_f32(mean);
+        float32x4_t z0, z1;
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            normal8(&z0, &z1);
+            vst1q_f32(out + i, vmlaq_n_f32(vmean, z0, std_deviation));
+            vst1q_f32(out + i + 4, vmlaq_n_f32(vmean, z1, std_deviation));
+        }
+        if (i < n) {
+            normal8(&z0, &z1);
+            z0 = vmlaq_n_f32(vmean, z0, std_deviation);
+            z1 = vmlaq_n_f32(vmean, z1, std_deviation);
+            if (n - i >= 4) {
+                vst1q_f32(out + i, z0);
+                i += 4;
+                z0 = z1;
+            }
+            store_partial(out + i, z0, n - i);
+        }
+    }
+};
+} // namespace distributions
+} // namespace math
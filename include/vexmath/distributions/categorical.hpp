@@ -0,0 +1,173 @@
+/**
+ * @file
+ * @brief Categorical sampling straight from log-weights (e.g. particle
+ * log-likelihoods) with the Gumbel-max trick.
+ *
+ * With g_i = -log(-log(u_i)) standard Gumbel PRNs, argmax_i (w_i + g_i) is
+ * drawn with probability exp(w_i) / sum_j exp(w_j). No weight is
+ * exponentiated or normalized, and adding a constant to every weight changes
+ * nothing, so unnormalized log-likelihoods can be used as is. Keeping the k
+ * largest perturbed weights instead of the largest one gives k draws without
+ * replacement (Gumbel-top-k, Kool et al. 2019).
+ *
+ * Weights are perturbed 4 at a time (two log_ps per 4 weights) and the argmax
+ * is kept per lane, so the only horizontal reduction is the final one.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus_vectorized.hpp"
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include <cstddef>
+#include <math.h>
+
+namespace math {
+namespace distributions {
+/**
+ * @brief index of the largest of 4 lanes, the smallest index wins ties
+ */
+inline uint32_t argmax_lanes(float32x4_t value, uint32x4_t index) {
+    float32x2_t m = vpmax_f32(vget_low_f32(value), vget_high_f32(value));
+    m = vpmax_f32(m, m);
+    uint32x4_t is_max = vceqq_f32(value, vdupq_lane_f32(m, 0));
+    uint32x4_t candidates = vbslq_u32(is_max, index, vdupq_n_u32(UINT32_MAX));
+    uint32x2_t i = vpmin_u32(vget_low_u32(candidates), vget_high_u32(candidates));
+    i = vpmin_u32(i, i);
+    return vget_lane_u32(i, 0);
+}
+
+/**
+ * @brief Index of the largest element of x (the first one on ties, NaNs are
+ * skipped)
+ *
+ * @param n number of elements, must be > 0
+ */
+inline size_t argmax(const float* x, size_t n) {
+    static const uint32_t lane_index[4] = { 0, 1, 2, 3 };
+    uint32x4_t index = vld1q_u32(lane_index), best_index = index;
+    float32x4_t best = vdupq_n_f32(-INFINITY);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t v = vld1q_f32(x + i);
+        uint32x4_t greater = vcgtq_f32(v, best);
+        best = vbslq_f32(greater, v, best);
+        best_index = vbslq_u32(greater, index, best_index);
+        index = vaddq_u32(index, vdupq_n_u32(4));
+    }
+    uint32_t result = argmax_lanes(best, best_index);
+    for (; i < n; i++) {
+        if (x[i] > x[result]) result = i;
+    }
+    return result;
+}
+
+/**
+ * @class CategoricalPRNG
+ * @brief Categorical PRN generator working on log-weights
+ */
+class CategoricalPRNG {
+  public:
+    /** largest k accepted by sample_top_k */
+    static constexpr size_t max_top_k = 64;
+
+    Vuniform_float32_t uniform_prng;
+
+    explicit CategoricalPRNG(uint32_t seed)
+        : uniform_prng(seed) {}
+
+    void set_seed(uint32_t seed) {
+        uniform_prng.setSeed(seed);
+    }
+
+    /**
+     * @brief 4 standard Gumbel PRNs, -log(-log(u)) with u in (0, 1)
+     */
+    inline float32x4_t gumbel4() {
+        float32x4_t e = vnegq_f32(log_ps(uniform_open(uniform_prng.next())));
+        return vnegq_f32(log_ps(e));
+    }
+
+    /**
+     * @brief Draws an index i with probability proportional to
+     * exp(log_weights[i])
+     *
+     * @param log_weights unnormalized log-weights, -inf for a zero weight
+     * @param n number of weights, must be > 0 with at least one finite weight
+     */
+    inline size_t sample(const float* log_weights, size_t n) {
+        static const uint32_t lane_index[4] = { 0, 1, 2, 3 };
+        uint32x4_t index = vld1q_u32(lane_index), best_index = index;
+        float32x4_t best = vdupq_n_f32(-INFINITY);
+        for (size_t i = 0; i < n; i += 4) {
+            float32x4_t w = i + 4 <= n ? vld1q_f32(log_weights + i) : tail(log_weights + i, n - i);
+            float32x4_t key = vaddq_f32(w, gumbel4());
+            uint32x4_t greater = vcgtq_f32(key, best);
+            best = vbslq_f32(greater, key, best);
+            best_index = vbslq_u32(greater, index, best_index);
+            index = vaddq_u32(index, vdupq_n_u32(4));
+        }
+        return argmax_lanes(best, best_index);
+    }
+
+    /**
+     * @brief Draws k distinct indices without replacement, each draw with
+     * probability proportional to exp(log_weights[i]) among the remaining
+     * ones
+     *
+     * @param out receives the indices in the order they were drawn
+     * @param k number of draws, at most max_top_k
+     * @return number of indices written, less than k if fewer than k weights
+     * are finite
+     */
+    inline size_t sample_top_k(const float* log_weights, size_t n, size_t* out, size_t k) {
+        if (k > max_top_k) k = max_top_k;
+        if (k > n) k = n;
+        if (k == 0) return 0;
+
+        /* the k largest keys so far, in decreasing order */
+        float keys[max_top_k];
+        size_t count = 0;
+        float threshold = -INFINITY;
+        for (size_t i = 0; i < n; i += 4) {
+            float32x4_t w = i + 4 <= n ? vld1q_f32(log_weights + i) : tail(log_weights + i, n - i);
+            float32x4_t key = vaddq_f32(w, gumbel4());
+            if (!any_lane(vcgtq_f32(key, vdupq_n_f32(threshold)))) continue;
+
+            float lanes[4];
+            vst1q_f32(lanes, key);
+            for (size_t j = 0; j < 4; j++) {
+                if (!(lanes[j] > threshold)) continue;
+                /* insertion, dropping the smallest key once there are k */
+                size_t pos = count < k ? count++ : k - 1;
+                for (; pos > 0 && keys[pos - 1] < lanes[j]; pos--) {
+                    keys[pos] = keys[pos - 1];
+                    out[pos] = out[pos - 1];
+                }
+                keys[pos] = lanes[j];
+                out[pos] = i + j;
+                if (count == k) threshold = keys[k - 1];
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Fills out with n standard Gumbel PRNs
+     */
+    void fill_gumbel(float* out, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_f32(out + i, gumbel4());
+        if (i < n) store_partial(out + i, gumbel4(), n - i);
+    }
+
+  private:
+    /* last count (< 4) weights, padded with -inf */
+    static inline float32x4_t tail(const float* log_weights, size_t count) {
+        float lanes[4] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+        for (size_t j = 0; j < count; j++) lanes[j] = log_weights[j];
+        return vld1q_f32(lanes);
+    }
+};
+} // namespace distributions
+} // namespace math
@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @brief Circular samplers for heading noise: von Mises and wrapped normal,
+ * 4 lanes at a time. Angles are returned wrapped to [-pi, pi) and their sine
+ * and cosine can be returned along with them.
+ *
+ * The von Mises sampler is Best and Fisher's (Efficient simulation of the von
+ * Mises distribution, 1979): a wrapped Cauchy proposal mapped through
+ * f = (1 + rz) / (r + z) with z = cos(pi u), where f is the cosine of the
+ * offset from the mean. Since cos and |sin| of the offset are known before
+ * the angle itself, the sine and cosine of the result are obtained by
+ * rotating (f, sqrt(1 - f^2)) by the mean instead of another sincos_ps.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/gamma.hpp"
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/functions/vectorized_angle.hpp"
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
+#include "vexmath/functions/vectorized_trig.hpp"
+#include <cstddef>
+#include <math.h>
+
+namespace math {
+namespace distributions {
+/**
+ * @brief Wraps angles to [-pi, pi), see wrap_pi_ps
+ */
+inline float32x4_t wrap_angle(float32x4_t x) {
+    return wrap_pi_ps(x);
+}
+
+/**
+ * @class CircularPRNG
+ * @brief von Mises and wrapped normal PRN generator
+ */
+class CircularPRNG : public GammaPRNG {
+  public:
+    /** above this concentration the von Mises distribution is sampled as a
+     * wrapped normal with variance 1/kappa (the parameters of Best-Fisher
+     * lose float precision) */
+    static constexpr float von_mises_normal_limit = 1e4f;
+    /** below this concentration the von Mises distribution is sampled as
+     * uniform */
+    static constexpr float von_mises_uniform_limit = 1e-5f;
+
+    explicit CircularPRNG(uint32_t seed)
+        : GammaPRNG(seed) {}
+
+    /**
+     * @brief 4 wrapped normal PRNs: mean + std_deviation * Z wrapped to
+     * [-pi, pi)
+     *
+     * @param ysin if not null, receives the sine of the angles
+     * @param ycos if not null, receives the cosine of the angles
+     */
+    inline float32x4_t wrapped_normal(float mean,
+                                      float std_deviation,
+                                      float32x4_t* ysin = nullptr,
+                                      float32x4_t* ycos = nullptr) {
+        float32x4_t angle = wrap_angle(vmlaq_n_f32(vdupq_n_f32(mean), normal4(), std_deviation));
+        return with_sincos(angle, ysin, ycos);
+    }
+
+    /**
+     * @brief 4 von Mises distributed PRNs wrapped to [-pi, pi)
+     *
+     * @param mean mean direction
+     * @param kappa concentration, >= 0
+     * @param ysin if not null, receives the sine of the angles
+     * @param ycos if not null, receives the cosine of the angles
+     */
+    inline float32x4_t von_mises(float mean,
+                                 float kappa,
+                                 float32x4_t* ysin = nullptr,
+                                 float32x4_t* ycos = nullptr) {
+        if (kappa > von_mises_normal_limit) {
+            return wrapped_normal(mean, 1 / sqrtf(kappa), ysin, ycos);
+        }
+        if (kappa < von_mises_uniform_limit) {
+            float32x4_t u = vsubq_f32(uniform_open(uniform_prng.next()), vdupq_n_f32(0.5f));
+            return with_sincos(vmulq_n_f32(u, 6.28318530717959f), ysin, ycos);
+        }
+
+        /* proposal parameters, in double since rho -> 1 as kappa grows */
+        const double tau = 1 + sqrt(1 + 4.0 * kappa * kappa);
+        const double rho = (tau - sqrt(2 * tau)) / (2.0 * kappa);
+        const float r = static_cast<float>((1 + rho * rho) / (2 * rho));
+
+        const float32x4_t one = vdupq_n_f32(1);
+        float32x4_t f = vdupq_n_f32(0);
+        uint32x4_t pending = vdupq_n_u32(~0u);
+        do {
+            v4sf s, z;
+            sincos_ps_bounded(vmulq_n_f32(uniform_open(uniform_prng.next()), 3.14159265358979f),
+                              &s,
+                              &z);
+            float32x4_t f_new = Vdiv<2>(vmlaq_n_f32(one, z, r), vaddq_f32(vdupq_n_f32(r), z));
+            float32x4_t c = vmulq_n_f32(vsubq_f32(vdupq_n_f32(r), f_new), kappa);
+            float32x4_t u = uniform_open0(uniform_prng.next());
+
+            /* squeeze: c (2 - c) > u, otherwise log(c / u) + 1 - c >= 0 */
+            uint32x4_t accept = vcgtq_f32(vmulq_f32(c, vsubq_f32(vdupq_n_f32(2), c)), u);
+            if (any_lane(vbicq_u32(pending, accept))) {
+                float32x4_t l = log_ps(Vdiv<2>(c, u));
+                accept = vorrq_u32(accept, vcgeq_f32(vaddq_f32(l, one), c));
+            }
+            accept = vandq_u32(accept, pending);
+            f = vbslq_f32(accept, f_new, f);
+            pending = vbicq_u32(pending, accept);
+        } while (any_lane(pending));
+        f = vmaxq_f32(vminq_f32(f, one), vnegq_f32(one));
+
+        /* offset from the mean is +-acos(f), the sign comes from a new random
+         * bit */
+        uint32x4_t sign = vandq_u32(uniform_prng.next(), vdupq_n_u32(0x80000000u));
+        float32x4_t offset =
+          vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(acos_ps(f)), sign));
+        float32x4_t angle = wrap_angle(vaddq_f32(vdupq_n_f32(mean), offset));
+
+        if (ysin || ycos) {
+            /* sin of the offset: sqrt(1 - f^2) with the offset's sign */
+            float32x4_t s = Vsqrt<2>(vmaxq_f32(vmlsq_f32(one, f, f), vdupq_n_f32(0)));
+            s = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(s), sign));
+            const float sin_mean = sinf(mean), cos_mean = cosf(mean);
+            /* rotate (cos, sin) of the offset by the mean */
+            if (ysin) *ysin = vmlaq_n_f32(vmulq_n_f32(s, cos_mean), f, sin_mean);
+            if (ycos) *ycos = vmlsq_n_f32(vmulq_n_f32(f, cos_mean), s, sin_mean);
+        }
+        return angle;
+    }
+
+    /**
+     * @brief Fills out with n wrapped normal PRNs, and their sine and cosine
+     * if ysin / ycos are not null
+     */
+    void fill_wrapped_normal(float* out,
+                             size_t n,
+                             float mean,
+                             float std_deviation,
+                             float* ysin = nullptr,
+                             float* ycos = nullptr) {
+        for (size_t i = 0; i < n; i += 4) {
+            float32x4_t s = vdupq_n_f32(0), c = s;
+            float32x4_t angle = wrapped_normal(mean, std_deviation, ysin ? &s : nullptr, ycos ? &c : nullptr);
+            store(out, ysin, ycos, i, n, angle, s, c);
+        }
+    }
+
+    /**
+     * @brief Fills out with n von Mises PRNs, and their sine and cosine if
+     * ysin / ycos are not null
+     */
+    void fill_von_mises(float* out,
+                        size_t n,
+                        float mean,
+                        float kappa,
+                        float* ysin = nullptr,
+                        float* ycos = nullptr) {
+        for (size_t i = 0; i < n; i += 4) {
+            float32x4_t s = vdupq_n_f32(0), c = s;
+            float32x4_t angle = von_mises(mean, kappa, ysin ? &s : nullptr, ycos ? &c : nullptr);
+            store(out, ysin, ycos, i, n, angle, s, c);
+        }
+    }
+
+  private:
+    inline float32x4_t with_sincos(float32x4_t angle, float32x4_t* ysin, float32x4_t* ycos) {
+        if (ysin || ycos) {
+            v4sf s, c;
+            sincos_ps(angle, &s, &c);
+            if (ysin) *ysin = s;
+            if (ycos) *ycos = c;
+        }
+        return angle;
+    }
+
+    static void store(float* out,
+                      float* ysin,
+                      float* ycos,
+                      size_t i,
+                      size_t n,
+                      float32x4_t angle,
+                      float32x4_t s,
+                      float32x4_t c) {
+        if (i + 4 <= n) {
+            vst1q_f32(out + i, angle);
+            if (ysin) vst1q_f32(ysin + i, s);
+            if (ycos) vst1q_f32(ycos + i, c);
+        } else {
+            store_partial(out + i, angle, n - i);
+            if (ysin) store_partial(ysin + i, s, n - i);
+            if (ycos) store_partial(ycos + i, c, n - i);
+        }
+    }
+};
+} // namespace distributions
+} // namespace math
@@ -0,0 +1,292 @@
+/**
+ * @file
+ * @brief Gamma, beta and Dirichlet samplers built on the ziggurat normal
+ * generator.
+ *
+ * Gamma variates use the Marsaglia-Tsang method (A simple method for
+ * generating gamma variables, ACM TOMS 2000): with d = alpha - 1/3 and
+ * c = 1/sqrt(9d), draw a normal x and a uniform u, set v = (1 + cx)^3 and
+ * accept d*v if log(u) < x^2/2 + d - dv + d*log(v). A cheap squeeze accepts
+ * most draws before the logarithm. alpha < 1 is handled by boosting:
+ * gamma(alpha) = gamma(alpha + 1) * u^(1/alpha).
+ *
+ * For small alpha the boost underflows (u^(1/alpha) is 0 in float for
+ * alpha = 0.01 and u < 0.4), so every gamma of a beta or Dirichlet draw can
+ * be 0 and the normalization gives 0/0. When a shape is below 1 those work
+ * with log G = log gamma(alpha + 1) + log(u) / alpha instead, and subtract
+ * the largest log before exponentiating.
+ *
+ * The vector versions sample 4 lanes (each with its own alpha) at once,
+ * rejected lanes are redrawn until every lane is accepted. Since the
+ * acceptance rate is above 95% for alpha >= 1 this rarely takes more than two
+ * rounds.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus_vectorized.hpp"
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
+#include "vexmath/ziggurat/normal.hpp"
+#include <cstddef>
+#include <math.h>
+
+namespace math {
+namespace distributions {
+/**
+ * @class GammaPRNG
+ * @brief Gamma, beta and Dirichlet PRN generator.
+ *
+ * Normals come from the scalar ziggurat, the uniforms of the vector versions
+ * from a vectorized xoroshiro seeded from the same seed.
+ */
+class GammaPRNG {
+  public:
+    ziggurat::NormalPRNG normal_prng;
+    VXoroshiro128plus uniform_prng;
+
+    explicit GammaPRNG(uint32_t seed)
+        : normal_prng(seed),
+          uniform_prng(seed ^ 0x9e3779b9u) {}
+
+    void set_seed(uint32_t seed) {
+        normal_prng.set_seed(seed);
+        uniform_prng.setSeed(seed ^ 0x9e3779b9u);
+    }
+
+    /** @brief uniform PRN in (0, 1] */
+    inline float uniform() {
+        return uniform_open0(normal_prng.random_int31());
+    }
+
+    /** @brief 4 independent standard normal PRNs */
+    inline float32x4_t normal4() {
+        return distributions::normal4(normal_prng);
+    }
+
+    /**
+     * @brief Gamma distributed PRN with shape alpha and scale 1
+     *
+     * @param alpha shape, must be > 0
+     */
+    inline float gamma(float alpha) {
+        if (alpha < 1) {
+            return gamma(alpha + 1) * powf(uniform(), 1 / alpha);
+        }
+        const float d = alpha - 1.0f / 3, c = 1 / sqrtf(9 * d);
+        for (;;) {
+            float x, v;
+            do {
+                x = normal_prng.normal();
+                v = 1 + c * x;
+            } while (v <= 0);
+            v = v * v * v;
+            float u = uniform(), x2 = x * x;
+            if (u < 1 - 0.0331f * x2 * x2) return d * v;
+            if (logf(u) < 0.5f * x2 + d * (1 - v + logf(v))) return d * v;
+        }
+    }
+
+    /**
+     * @brief Logarithm of a gamma distributed PRN with shape alpha and scale
+     * 1, finite where gamma(alpha) underflows to 0
+     *
+     * @param alpha shape, must be > 0
+     */
+    inline float log_gamma(float alpha) {
+        if (alpha < 1) {
+            return logf(gamma(alpha + 1)) + logf(uniform()) / alpha;
+        }
+        return logf(gamma(alpha));
+    }
+
+    /**
+     * @brief Gamma distributed PRN with shape alpha and scale theta
+     */
+    inline float gamma(float alpha, float theta) {
+        return gamma(alpha) * theta;
+    }
+
+    /**
+     * @brief 4 gamma distributed PRNs with scale 1, lane i has shape alpha[i]
+     *
+     * @param alpha shapes, must be > 0
+     */
+    inline float32x4_t gamma(float32x4_t alpha) {
+        const float32x4_t one = vdupq_n_f32(1);
+        const uint32x4_t boost = vcltq_f32(alpha, one);
+        const float32x4_t shape = vbslq_f32(boost, vaddq_f32(alpha, one), alpha);
+        const float32x4_t d = vsubq_f32(shape, vdupq_n_f32(1.0f / 3));
+        const float32x4_t c = Vrsqrt<2>(vmulq_n_f32(d, 9));
+
+        float32x4_t result = vdupq_n_f32(0);
+        uint32x4_t pending = vdupq_n_u32(~0u);
+        do {
+            float32x4_t x = normal4();
+            float32x4_t v = vmlaq_f32(one, c, x);
+            uint32x4_t valid = vcgtq_f32(v, vdupq_n_f32(0));
+            v = vmulq_f32(vmulq_f32(v, v), v);
+            float32x4_t u = uniform_open0(uniform_prng.next());
+            float32x4_t x2 = vmulq_f32(x, x);
+
+            /* squeeze: u < 1 - 0.0331 x^4 */
+            uint32x4_t accept = vcltq_f32(u, vmlsq_f32(one, vmulq_n_f32(x2, 0.0331f), x2));
+            if (any_lane(vbicq_u32(pending, vandq_u32(accept, valid)))) {
+                /* log(u) < x^2/2 + d (1 - v + log(v)), v is clamped so that
+                 * log_ps stays finite on the invalid lanes */
+                float32x4_t log_v = log_ps(vmaxq_f32(v, vdupq_n_f32(1e-30f)));
+                float32x4_t bound = vmlaq_f32(vmulq_n_f32(x2, 0.5f),
+                                              d,
+                                              vaddq_f32(vsubq_f32(one, v), log_v));
+                accept = vorrq_u32(accept, vcltq_f32(log_ps(u), bound));
+            }
+            accept = vandq_u32(vandq_u32(accept, valid), pending);
+            result = vbslq_f32(accept, vmulq_f32(d, v), result);
+            pending = vbicq_u32(pending, accept);
+        } while (any_lane(pending));
+
+        if (any_lane(boost)) {
+            /* u^(1/alpha) = exp(log(u) / alpha) */
+            float32x4_t u = uniform_open0(uniform_prng.next());
+            float32x4_t scale = exp_ps(vmulq_f32(log_ps(u), Vrecip<2>(alpha)));
+            result = vbslq_f32(boost, vmulq_f32(result, scale), result);
+        }
+        return result;
+    }
+
+    /**
+     * @brief 4 logarithms of gamma distributed PRNs with scale 1, lane i has
+     * shape alpha[i]
+     *
+     * @param alpha shapes, must be > 0
+     */
+    inline float32x4_t log_gamma(float32x4_t alpha) {
+        const float32x4_t one = vdupq_n_f32(1);
+        const uint32x4_t boost = vcltq_f32(alpha, one);
+        float32x4_t result = log_ps(gamma(vbslq_f32(boost, vaddq_f32(alpha, one), alpha)));
+        if (any_lane(boost)) {
+            float32x4_t u = uniform_open0(uniform_prng.next());
+            float32x4_t log_scale = vmulq_f32(log_ps(u), Vrecip<2>(alpha));
+            result = vbslq_f32(boost, vaddq_f32(result, log_scale), result);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Beta distributed PRN: X / (X + Y) with X ~ gamma(a), Y ~ gamma(b)
+     */
+    inline float beta(float a, float b) {
+        if (a < 1 || b < 1) {
+            /* 1 / (1 + Y / X), X and Y can both underflow */
+            return 1 / (1 + expf(log_gamma(b) - log_gamma(a)));
+        }
+        float x = gamma(a);
+        return x / (x + gamma(b));
+    }
+
+    /**
+     * @brief 4 beta distributed PRNs, lane i has parameters a[i], b[i]
+     */
+    inline float32x4_t beta(float32x4_t a, float32x4_t b) {
+        const float32x4_t one = vdupq_n_f32(1);
+        if (any_lane(vorrq_u32(vcltq_f32(a, one), vcltq_f32(b, one)))) {
+            float32x4_t ratio = exp_ps(vsubq_f32(log_gamma(b), log_gamma(a)));
+            return Vrecip<2>(vaddq_f32(one, ratio));
+        }
+        float32x4_t x = gamma(a);
+        float32x4_t y = gamma(b);
+        return Vdiv<2>(x, vaddq_f32(x, y));
+    }
+
+    /**
+     * @brief Dirichlet distributed vector: k gamma variates normalized to sum
+     * to 1
+     *
+     * @param alpha k concentration parameters, must be > 0
+     * @param out k output weights
+     * @param k number of components
+     */
+    inline void dirichlet(const float* alpha, float* out, size_t k) {
+        bool small = false;
+        for (size_t j = 0; j < k; j++) small = small || alpha[j] < 1;
+
+        float sum = 0;
+        size_t j = 0;
+        if (small) {
+            /* logs first, then exp(log G - max log): the largest weight is 1
+             * so the sum can't be 0 */
+            float32x4_t vmax = vdupq_n_f32(-INFINITY);
+            float max_log = -INFINITY;
+            for (; j + 4 <= k; j += 4) {
+                float32x4_t l = log_gamma(vld1q_f32(alpha + j));
+                vst1q_f32(out + j, l);
+                vmax = vmaxq_f32(vmax, l);
+            }
+            for (; j < k; j++) {
+                out[j] = log_gamma(alpha[j]);
+                max_log = fmaxf(max_log, out[j]);
+            }
+            float32x2_t m = vpmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
+            max_log = fmaxf(max_log, vget_lane_f32(vpmax_f32(m, m), 0));
+
+            const float32x4_t shift = vdupq_n_f32(max_log);
+            for (j = 0; j + 4 <= k; j += 4) {
+                float32x4_t g = exp_ps(vsubq_f32(vld1q_f32(out + j), shift));
+                vst1q_f32(out + j, g);
+                sum += vgetq_lane_f32(g, 0) + vgetq_lane_f32(g, 1) +
+                       vgetq_lane_f32(g, 2) + vgetq_lane_f32(g, 3);
+            }
+            for (; j < k; j++) {
+                out[j] = expf(out[j] - max_log);
+                sum += out[j];
+            }
+        } else {
+            for (; j + 4 <= k; j += 4) {
+                float32x4_t g = gamma(vld1q_f32(alpha + j));
+                vst1q_f32(out + j, g);
+                sum += vgetq_lane_f32(g, 0) + vgetq_lane_f32(g, 1) +
+                       vgetq_lane_f32(g, 2) + vgetq_lane_f32(g, 3);
+            }
+            for (; j < k; j++) {
+                out[j] = gamma(alpha[j]);
+                sum += out[j];
+            }
+        }
+        const float inv_sum = 1 / sum;
+        for (j = 0; j < k; j++) out[j] *= inv_sum;
+    }
+
+    /**
+     * @brief Fills out with n gamma distributed PRNs of shape alpha and scale
+     * theta
+     */
+    void fill_gamma(float* out, size_t n, float alpha, float theta = 1) {
+        const float32x4_t valpha = vdupq_n_f32(alpha);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            vst1q_f32(out + i, vmulq_n_f32(gamma(valpha), theta));
+        }
+        for (; i < n; i++) out[i] = gamma(alpha, theta);
+    }
+
+    /**
+     * @brief Fills out with n beta distributed PRNs
+     */
+    void fill_beta(float* out, size_t n, float a, float b) {
+        const float32x4_t va = vdupq_n_f32(a), vb = vdupq_n_f32(b);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_f32(out + i, beta(va, vb));
+        for (; i < n; i++) out[i] = beta(a, b);
+    }
+
+    /**
+     * @brief Fills out with n Dirichlet distributed vectors of k components
+     * each, stored one after the other (out must hold n * k floats)
+     */
+    void fill_dirichlet(float* out, size_t n, const float* alpha, size_t k) {
+        for (size_t i = 0; i < n; i++) dirichlet(alpha, out + i * k, k);
+    }
+};
+} // namespace distributions
+} // namespace math
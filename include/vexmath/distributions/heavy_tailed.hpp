@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief Heavy-tailed samplers for robust sensor models: Cauchy, Laplace and
+ * Student-t, 4 lanes at a time.
+ *
+ * Cauchy     -> tan of a uniform angle in (-pi/2, pi/2), computed as the
+ *               sin/cos ratio from a single sincos_ps.
+ * Laplace    -> exponential (-log of a uniform) with a random sign taken from
+ *               a spare bit of the same random word.
+ * Student-t  -> Z / sqrt(V / nu), Z standard normal from the ziggurat and
+ *               V ~ chi^2(nu) = 2 gamma(nu / 2).
+ */
+
+#pragma once
+
+#include "vexmath/distributions/gamma.hpp"
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
+#include "vexmath/functions/vectorized_trig.hpp"
+#include <cstddef>
+
+namespace math {
+namespace distributions {
+/**
+ * @class HeavyTailedPRNG
+ * @brief Cauchy, Laplace and Student-t PRN generator. Also provides
+ * everything GammaPRNG does.
+ */
+class HeavyTailedPRNG : public GammaPRNG {
+  public:
+    explicit HeavyTailedPRNG(uint32_t seed)
+        : GammaPRNG(seed) {}
+
+    /**
+     * @brief 4 Cauchy distributed PRNs
+     *
+     * @param location median
+     * @param scale half width at half maximum
+     */
+    inline float32x4_t cauchy(float location = 0, float scale = 1) {
+        /* angle in (-pi/2, pi/2), cos never reaches 0 */
+        float32x4_t angle = vmulq_n_f32(vsubq_f32(uniform_open(uniform_prng.next()),
+                                                  vdupq_n_f32(0.5f)),
+                                        3.14159265358979f);
+        v4sf s, c;
+        sincos_ps_bounded(angle, &s, &c);
+        return vmlaq_n_f32(vdupq_n_f32(location), Vdiv<2>(s, c), scale);
+    }
+
+    /**
+     * @brief 4 Laplace distributed PRNs
+     *
+     * @param location mean
+     * @param scale diversity, the variance is 2 * scale^2
+     */
+    inline float32x4_t laplace(float location = 0, float scale = 1) {
+        uint32x4_t bits = uniform_prng.next();
+        /* uniform_open0 uses the top 23 bits, bit 8 becomes the sign */
+        float32x4_t e = vnegq_f32(log_ps(uniform_open0(bits)));
+        uint32x4_t sign = vandq_u32(vshlq_n_u32(bits, 23), vdupq_n_u32(0x80000000u));
+        e = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(e), sign));
+        return vmlaq_n_f32(vdupq_n_f32(location), e, scale);
+    }
+
+    /**
+     * @brief 4 Student-t distributed PRNs
+     *
+     * @param nu degrees of freedom, must be > 0
+     */
+    inline float32x4_t student_t(float nu) {
+        float32x4_t z = normal4();
+        float32x4_t chi2 = vmulq_n_f32(gamma(vdupq_n_f32(0.5f * nu)), 2);
+        /* z / sqrt(chi2 / nu), with Vrsqrt<2>: the single step of V_rsqrt
+         * leaves a 0.2% error in the scale */
+        return vmulq_f32(z, Vrsqrt<2>(vmulq_n_f32(chi2, 1 / nu)));
+    }
+
+    /**
+     * @brief Fills out with n Cauchy distributed PRNs
+     */
+    void fill_cauchy(float* out, size_t n, float location = 0, float scale = 1) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_f32(out + i, cauchy(location, scale));
+        if (i < n) store_partial(out + i, cauchy(location, scale), n - i);
+    }
+
+    /**
+     * @brief Fills out with n Laplace distributed PRNs
+     */
+    void fill_laplace(float* out, size_t n, float location = 0, float scale = 1) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_f32(out + i, laplace(location, scale));
+        if (i < n) store_partial(out + i, laplace(location, scale), n - i);
+    }
+
+    /**
+     * @brief Fills out with n Student-t distributed PRNs
+     */
+    void fill_student_t(float* out, size_t n, float nu) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_f32(out + i, student_t(nu));
+        if (i < n) store_partial(out + i, student_t(nu), n - i);
+    }
+};
+} // namespace distributions
+} // namespace math
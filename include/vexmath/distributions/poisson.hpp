@@ -0,0 +1,210 @@
+/**
+ * @file
+ * @brief Poisson and binomial samplers.
+ *
+ * Small means are sampled by inversion (sequential search through the CDF),
+ * large ones with Hormann's transformed rejection with squeeze: PTRS for
+ * Poisson and BTRS for binomial (The transformed rejection method for
+ * generating Poisson random variables, 1993 / The generation of binomial
+ * random variates, 1993). Both need 2 uniforms and accept about 90% of the
+ * time, with most acceptances decided before any logarithm.
+ *
+ * The inversion walks the same pmf for every lane, only the uniform differs,
+ * so the vector versions keep the pmf and the running CDF as scalars and only
+ * count in how many steps each lane's uniform is still above the CDF. The
+ * search ends when the next term no longer changes the CDF in float: a
+ * uniform above the last CDF value gets the last value that did, instead of
+ * running off into the tail.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus_vectorized.hpp"
+#include <cstddef>
+#include <math.h>
+
+namespace math {
+namespace distributions {
+/**
+ * @class PoissonPRNG
+ * @brief Poisson and binomial PRN generator
+ */
+class PoissonPRNG {
+  public:
+    /** means below this are sampled by inversion */
+    static constexpr float inversion_limit = 10;
+
+    Xoroshiro128plus prng;
+    Vuniform_float32_t uniform_prng;
+
+    explicit PoissonPRNG(uint32_t seed)
+        : prng(seed),
+          uniform_prng(seed ^ 0x9e3779b9u) {}
+
+    void set_seed(uint32_t seed) {
+        prng.setSeed(seed);
+        uniform_prng.setSeed(seed ^ 0x9e3779b9u);
+    }
+
+    /**
+     * @brief uniform PRN in (0, 1), the midpoints of 2^23 equal cells (so
+     * that U - 1/2 never reaches -1/2 in the rejection samplers)
+     */
+    inline float uniform() {
+        return ((prng.next() >> 9) + 0.5f) * (1.0f / 8388608.0f);
+    }
+
+    /**
+     * @brief Poisson distributed PRN with mean lambda
+     */
+    inline int32_t poisson(float lambda) {
+        if (lambda < inversion_limit) {
+            float p = expf(-lambda), s = p, u = uniform();
+            int32_t x = 0;
+            while (u >= s) {
+                p *= lambda / (x + 1);
+                const float next = s + p;
+                if (next == s) break; /* the rest is below float resolution */
+                s = next;
+                x++;
+            }
+            return x;
+        }
+
+        /* PTRS */
+        const float slam = sqrtf(lambda), loglam = logf(lambda);
+        const float b = 0.931f + 2.53f * slam;
+        const float a = -0.059f + 0.02483f * b;
+        const float log_inv_alpha = logf(1.1239f + 1.1328f / (b - 3.4f));
+        const float vr = 0.9277f - 3.6224f / (b - 2);
+        for (;;) {
+            float U = uniform() - 0.5f;
+            float V = uniform_open0(prng.next() >> 1);
+            float us = 0.5f - fabsf(U);
+            int32_t k = static_cast<int32_t>(floorf((2 * a / us + b) * U + lambda + 0.43f));
+            if (us >= 0.07f && V <= vr) return k;
+            if (k < 0 || (us < 0.013f && V > us)) continue;
+            /* lgamma grows like k log k, evaluate it in double so that the
+             * cancellation does not eat the float mantissa for large lambda */
+            if (logf(V) + log_inv_alpha - logf(a / (us * us) + b) <=
+                -lambda + k * static_cast<double>(loglam) - lgamma(k + 1.0)) {
+                return k;
+            }
+        }
+    }
+
+    /**
+     * @brief 4 Poisson distributed PRNs with mean lambda
+     */
+    inline int32x4_t poisson4(float lambda) {
+        if (lambda >= inversion_limit) {
+            int32_t k[4] = { poisson(lambda), poisson(lambda), poisson(lambda), poisson(lambda) };
+            return vld1q_s32(k);
+        }
+        const float32x4_t u = uniform_prng.get_reduced_float();
+        float p = expf(-lambda), s = p;
+        int32x4_t x = vdupq_n_s32(0);
+        uint32x4_t active = vcgeq_f32(u, vdupq_n_f32(s));
+        for (int t = 1; any_lane(active); t++) {
+            p *= lambda / t;
+            const float next = s + p;
+            if (next == s) break; /* see poisson() */
+            x = vsubq_s32(x, vreinterpretq_s32_u32(active)); /* active lanes are -1 */
+            s = next;
+            active = vcgeq_f32(u, vdupq_n_f32(s));
+        }
+        return x;
+    }
+
+    /**
+     * @brief Binomial distributed PRN: number of successes in n trials of
+     * probability p
+     */
+    inline int32_t binomial(int32_t n, float p) {
+        if (p > 0.5f) return n - binomial(n, 1 - p);
+        if (n <= 0 || p <= 0) return 0;
+        const float q = 1 - p;
+        if (n * p < inversion_limit) {
+            const float ratio = p / q, a = (n + 1) * ratio;
+            float r = powf(q, static_cast<float>(n)), s = r, u = uniform();
+            int32_t x = 0;
+            while (u >= s && x < n) {
+                r *= a / (x + 1) - ratio;
+                const float next = s + r;
+                if (next == s) break; /* see poisson() */
+                s = next;
+                x++;
+            }
+            return x;
+        }
+
+        /* BTRS */
+        const float spq = sqrtf(n * p * q);
+        const float b = 1.15f + 2.53f * spq;
+        const float a = -0.0873f + 0.0248f * b + 0.01f * p;
+        const float c = n * p + 0.5f;
+        const float vr = 0.92f - 4.2f / b;
+        const float alpha = (2.83f + 5.1f / b) * spq;
+        const float lpq = logf(p / q);
+        const int32_t m = static_cast<int32_t>(floorf((n + 1) * p));
+        const double h = lgamma(m + 1.0) + lgamma(n - m + 1.0); /* see PTRS */
+        for (;;) {
+            float U = uniform() - 0.5f;
+            float V = uniform_open0(prng.next() >> 1);
+            float us = 0.5f - fabsf(U);
+            int32_t k = static_cast<int32_t>(floorf((2 * a / us + b) * U + c));
+            if (k < 0 || k > n) continue;
+            if (us >= 0.07f && V <= vr) return k;
+            double bound = h - lgamma(k + 1.0) - lgamma(n - k + 1.0) + (k - m) * static_cast<double>(lpq);
+            if (logf(V * alpha / (a / (us * us) + b)) <= bound) return k;
+        }
+    }
+
+    /**
+     * @brief 4 binomial distributed PRNs
+     */
+    inline int32x4_t binomial4(int32_t n, float p) {
+        const bool flip = p > 0.5f;
+        const float p_low = flip ? 1 - p : p;
+        if (n <= 0 || p_low <= 0 || n * p_low >= inversion_limit) {
+            int32_t k[4] = { binomial(n, p), binomial(n, p), binomial(n, p), binomial(n, p) };
+            return vld1q_s32(k);
+        }
+        const float q = 1 - p_low, ratio = p_low / q, a = (n + 1) * ratio;
+        const float32x4_t u = uniform_prng.get_reduced_float();
+        float r = powf(q, static_cast<float>(n)), s = r;
+        int32x4_t x = vdupq_n_s32(0);
+        uint32x4_t active = vcgeq_f32(u, vdupq_n_f32(s));
+        for (int32_t t = 1; t <= n && any_lane(active); t++) {
+            r *= a / t - ratio;
+            const float next = s + r;
+            if (next == s) break;
+            x = vsubq_s32(x, vreinterpretq_s32_u32(active));
+            s = next;
+            active = vcgeq_f32(u, vdupq_n_f32(s));
+        }
+        return flip ? vsubq_s32(vdupq_n_s32(n), x) : x;
+    }
+
+    /**
+     * @brief Fills out with n Poisson distributed PRNs with mean lambda
+     */
+    void fill_poisson(int32_t* out, size_t n, float lambda) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_s32(out + i, poisson4(lambda));
+        for (; i < n; i++) out[i] = poisson(lambda);
+    }
+
+    /**
+     * @brief Fills out with n binomial distributed PRNs
+     */
+    void fill_binomial(int32_t* out, size_t n, int32_t trials, float p) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_s32(out + i, binomial4(trials, p));
+        for (; i < n; i++) out[i] = binomial(trials, p);
+    }
+};
+} // namespace distributions
+} // namespace math
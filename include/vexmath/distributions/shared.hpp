@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @brief Helpers shared by the samplers in distributions/: lane reductions
+ * and uniform conversions.
+ */
+
+#pragma once
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace math {
+namespace distributions {
+/** @brief true if any lane of the mask is set */
+inline bool any_lane(uint32x4_t mask) {
+    uint32x2_t m = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return vget_lane_u32(vpmax_u32(m, m), 0) != 0;
+}
+
+/** @brief true if every lane of the mask is set */
+inline bool all_lanes(uint32x4_t mask) {
+    uint32x2_t m = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return vget_lane_u32(vpmin_u32(m, m), 0) != 0;
+}
+
+/**
+ * @brief uniform float in (0, 1] from 31 random bits, safe to pass to log
+ */
+inline float uniform_open0(int32_t bits31) {
+    /* the + 1 is done unsigned, bits31 can be INT32_MAX */
+    return (static_cast<uint32_t>(bits31) + 1u) * (1.0f / 2147483648.0f);
+}
+
+/**
+ * @brief 4 uniform floats in (0, 1] from 32 random bits per lane, safe to pass
+ * to log_ps
+ */
+inline float32x4_t uniform_open0(uint32x4_t bits) {
+    /* top 23 bits as the mantissa of [1, 2), then 2 - m lies in (0, 1] */
+    uint32x4_t m = vorrq_u32(vdupq_n_u32(127U << 23), vshrq_n_u32(bits, 9));
+    return vsubq_f32(vdupq_n_f32(2), vreinterpretq_f32_u32(m));
+}
+
+/**
+ * @brief 4 uniform floats in (0, 1) (both ends excluded) from the top 23 bits
+ * of every lane, the midpoints of 2^23 equal cells
+ */
+inline float32x4_t uniform_open(uint32x4_t bits) {
+    uint32x4_t m = vorrq_u32(vdupq_n_u32(127U << 23), vshrq_n_u32(bits, 9));
+    return vsubq_f32(vreinterpretq_f32_u32(m), vdupq_n_f32(1 - 0.5f / 8388608));
+}
+
+/**
+ * @brief 4 independent standard normal PRNs from a scalar generator with a
+ * normal() method (e.g. ziggurat::NormalPRNG)
+ */
+template<typename Normal>
+inline float32x4_t normal4(Normal& gen) {
+    float n[4] = { gen.normal(), gen.normal(), gen.normal(), gen.normal() };
+    return vld1q_f32(n);
+}
+
+/** @brief stores the first count (< 4) lanes of v, for the tail of fills */
+inline void store_partial(float* out, float32x4_t v, size_t count) {
+    float lanes[4];
+    vst1q_f32(lanes, v);
+    for (size_t i = 0; i < count; i++) out[i] = lanes[i];
+}
+} // namespace distributions
+} // namespace math
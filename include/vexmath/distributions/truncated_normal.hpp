@@ -0,0 +1,182 @@
+/**
+ * @file
+ * @brief Normal distribution truncated to [lo, hi], for bounded sensor noise.
+ *
+ * Rejecting normal(mean, sd) until it lands in range costs 1 / P(range)
+ * draws, which explodes when the range is in the tail. Following Robert
+ * (Simulation of truncated normal variables, 1995) the proposal is picked
+ * once per range, on the standardized bounds a < b:
+ *
+ *  normal      -> 0 in [a, b] and b - a > sqrt(2 pi): ziggurat normals,
+ *                 rejected outside [a, b]
+ *  uniform     -> narrow range: z uniform on [a, b], accepted with
+ *                 probability exp((a^2 - z^2) / 2) (a^2 -> 0 if 0 in [a, b])
+ *  exponential -> tail range a > 0: z = a + E / lambda with the optimal rate
+ *                 lambda = (a + sqrt(a^2 + 4)) / 2, accepted with
+ *                 probability exp(-(z - lambda)^2 / 2) if z <= b
+ *
+ * Ranges entirely below 0 are mirrored. Every proposal accepts at least
+ * about half of the time whatever the bounds, and the loop is capped at
+ * max_attempts rounds, so the worst case cost is fixed. When the cap is hit
+ * (probability below 1e-9) the uniform and exponential proposals return
+ * their last in-range proposal. The normal proposal accepts every in-range
+ * draw, so it has none and returns 0, the mean, which its ranges contain.
+ * A lane that drew nothing in range at all gets the bound closest to 0.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus_vectorized.hpp"
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/ziggurat/normal.hpp"
+#include <cstddef>
+#include <math.h>
+
+namespace math {
+namespace distributions {
+/**
+ * @brief Proposal chosen for a truncation range, see truncated_normal.hpp
+ */
+struct normal_truncation {
+    enum kind_t : uint8_t { NORMAL, UNIFORM, EXPONENTIAL };
+
+    kind_t kind;
+    bool flip;    /* range was mirrored, negate the result */
+    float a, b;   /* standardized bounds after mirroring */
+    float shift;  /* a^2 for the uniform proposal in the tail, else 0 */
+    float lambda; /* rate of the exponential proposal */
+
+    normal_truncation(float mean, float sd, float lo, float hi) {
+        a = (lo - mean) / sd;
+        b = (hi - mean) / sd;
+        flip = b <= 0;
+        if (flip) {
+            float t = -a;
+            a = -b;
+            b = t;
+        }
+        shift = 0;
+        lambda = 0;
+        if (a <= 0) { /* 0 in [a, b] */
+            kind = b - a > 2.50662827463f ? NORMAL : UNIFORM;
+            return;
+        }
+        const float root = sqrtf(a * a + 4);
+        lambda = 0.5f * (a + root);
+        /* uniform beats exponential if b is close enough to a */
+        const float limit = a + 2 * 1.6487212707f / (a + root) * expf(0.25f * (a * a - a * root));
+        kind = b <= limit ? UNIFORM : EXPONENTIAL;
+        shift = a * a;
+    }
+};
+
+/**
+ * @class TruncatedNormalPRNG
+ * @brief Truncated normal PRN generator
+ */
+class TruncatedNormalPRNG {
+  public:
+    /** rounds of rejection before giving up */
+    static constexpr int max_attempts = 32;
+
+    ziggurat::NormalPRNG normal_prng;
+    VXoroshiro128plus uniform_prng;
+
+    explicit TruncatedNormalPRNG(uint32_t seed)
+        : normal_prng(seed),
+          uniform_prng(seed ^ 0x9e3779b9u) {}
+
+    void set_seed(uint32_t seed) {
+        normal_prng.set_seed(seed);
+        uniform_prng.setSeed(seed ^ 0x9e3779b9u);
+    }
+
+    /**
+     * @brief Normal PRN with mean and std deviation sd, truncated to [lo, hi]
+     * (the bounds may be infinite)
+     */
+    inline float truncated_normal(float mean, float sd, float lo, float hi) {
+        return truncated_normal(mean, sd, normal_truncation(mean, sd, lo, hi));
+    }
+
+    /**
+     * @brief same as above with the proposal already chosen, to draw many
+     * PRNs from the same range
+     */
+    inline float truncated_normal(float mean, float sd, const normal_truncation& t) {
+        float z = t.a > 0 ? t.a : (t.b < 0 ? t.b : 0); /* fallback: closest to 0 in range */
+        for (int attempt = 0; attempt < max_attempts; attempt++) {
+            if (t.kind == normal_truncation::NORMAL) {
+                float x = normal_prng.normal();
+                if (x >= t.a && x <= t.b) {
+                    z = x;
+                    break;
+                }
+            } else if (t.kind == normal_truncation::UNIFORM) {
+                float x = t.a + (t.b - t.a) * (normal_prng.random_int31() * (1.0f / 2147483648.0f));
+                z = x;
+                float u = uniform_open0(normal_prng.random_int31());
+                if (logf(u) <= 0.5f * (t.shift - x * x)) break;
+            } else {
+                float x = t.a + normal_prng.exponential() / t.lambda;
+                if (x > t.b) continue;
+                z = x;
+                float u = uniform_open0(normal_prng.random_int31());
+                if (logf(u) <= -0.5f * (x - t.lambda) * (x - t.lambda)) break;
+            }
+        }
+        return mean + sd * (t.flip ? -z : z);
+    }
+
+    /**
+     * @brief 4 truncated normal PRNs from the same range
+     */
+    inline float32x4_t truncated_normal4(float mean, float sd, const normal_truncation& t) {
+        const float32x4_t a = vdupq_n_f32(t.a), b = vdupq_n_f32(t.b);
+        float32x4_t z = vdupq_n_f32(t.a > 0 ? t.a : (t.b < 0 ? t.b : 0));
+        uint32x4_t pending = vdupq_n_u32(~0u);
+        for (int attempt = 0; attempt < max_attempts && any_lane(pending); attempt++) {
+            float32x4_t x;
+            uint32x4_t accept;
+            if (t.kind == normal_truncation::NORMAL) {
+                x = normal4(normal_prng);
+                accept = vandq_u32(vcgeq_f32(x, a), vcleq_f32(x, b));
+            } else {
+                float32x4_t log_u = log_ps(uniform_open0(uniform_prng.next()));
+                float32x4_t bound;
+                if (t.kind == normal_truncation::UNIFORM) {
+                    x = vmlaq_n_f32(a, uniform_open0(uniform_prng.next()), t.b - t.a);
+                    x = vminq_f32(x, b);
+                    bound = vmulq_n_f32(vmlsq_f32(vdupq_n_f32(t.shift), x, x), 0.5f);
+                    accept = vdupq_n_u32(~0u);
+                } else {
+                    float32x4_t e = vnegq_f32(log_ps(uniform_open0(uniform_prng.next())));
+                    x = vmlaq_n_f32(a, e, 1 / t.lambda);
+                    float32x4_t d = vsubq_f32(x, vdupq_n_f32(t.lambda));
+                    bound = vmulq_n_f32(vmulq_f32(d, d), -0.5f);
+                    accept = vcleq_f32(x, b);
+                }
+                /* keep the last in-range proposal for the fallback */
+                z = vbslq_f32(vandq_u32(accept, pending), x, z);
+                accept = vandq_u32(accept, vcleq_f32(log_u, bound));
+            }
+            accept = vandq_u32(accept, pending);
+            z = vbslq_f32(accept, x, z);
+            pending = vbicq_u32(pending, accept);
+        }
+        return vmlaq_n_f32(vdupq_n_f32(mean), z, t.flip ? -sd : sd);
+    }
+
+    /**
+     * @brief Fills out with n normal PRNs truncated to [lo, hi]
+     */
+    void fill_truncated_normal(float* out, size_t n, float mean, float sd, float lo, float hi) {
+        const normal_truncation t(mean, sd, lo, hi);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) vst1q_f32(out + i, truncated_normal4(mean, sd, t));
+        if (i < n) store_partial(out + i, truncated_normal4(mean, sd, t), n - i);
+    }
+};
+} // namespace distributions
+} // namespace math
@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @brief Variance reduction helpers for Monte Carlo evaluation (e.g. tuning
+ * autonomous routines in simulation).
+ *
+ * Antithetic variates: every draw is followed by its mirror image (u then
+ * 1 - u, z then -z). For an estimate that is monotone in the noise the errors
+ * of a pair cancel in part, and the mean of each pair is exact.
+ *
+ * Common random numbers: competing evaluations (two controllers, two sets of
+ * gains) are run on identical noise so that their difference only reflects
+ * the change being compared. CommonStreams hands out one substream per
+ * scenario, 2^64 draws apart thanks to jump(), and the same substream every
+ * time the same scenario is asked for.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/shared.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus.hpp"
+#include "vexmath/fast_prng/Xoroshiro128plus_vectorized.hpp"
+#include "vexmath/ziggurat/normal.hpp"
+#include <cstddef>
+
+namespace math {
+namespace distributions {
+/**
+ * @class AntitheticUniform
+ * @brief Uniform PRNs in (0, 1) returned in antithetic pairs u, 1 - u
+ *
+ * Uniforms are cell midpoints (see uniform_open), so 1 - u is exact.
+ */
+class AntitheticUniform {
+  public:
+    VXoroshiro128plus prng;
+
+    explicit AntitheticUniform(uint64_t seed)
+        : prng(seed) {}
+
+    void set_seed(uint64_t seed) {
+        prng.setSeed(seed);
+        mirrored = false;
+    }
+
+    /**
+     * @brief 4 uniforms, every other call returns 1 - the previous ones
+     */
+    inline float32x4_t uniform4() {
+        if (mirrored) {
+            mirrored = false;
+            return vsubq_f32(vdupq_n_f32(1), last);
+        }
+        mirrored = true;
+        last = uniform_open(prng.next());
+        return last;
+    }
+
+    /**
+     * @brief 4 new uniforms and their mirror images
+     */
+    inline void pair(float32x4_t* u, float32x4_t* mirror) {
+        *u = uniform_open(prng.next());
+        *mirror = vsubq_f32(vdupq_n_f32(1), *u);
+    }
+
+    /**
+     * @brief Fills out with n uniforms in antithetic pairs: in every block of
+     * 8, out[i + 4] = 1 - out[i]
+     */
+    void fill(float* out, size_t n) {
+        float32x4_t u, mirror;
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            pair(&u, &mirror);
+            vst1q_f32(out + i, u);
+            vst1q_f32(out + i + 4, mirror);
+        }
+        if (i < n) {
+            pair(&u, &mirror);
+            if (n - i > 4) {
+                vst1q_f32(out + i, u);
+                store_partial(out + i + 4, mirror, n - i - 4);
+            } else {
+                store_partial(out + i, u, n - i);
+            }
+        }
+    }
+
+  private:
+    float32x4_t last = vdupq_n_f32(0);
+    bool mirrored = false;
+};
+
+/**
+ * @class AntitheticNormal
+ * @brief Normal PRNs returned in antithetic pairs z, -z, with the interface
+ * of ziggurat::NormalPRNG
+ *
+ * @tparam Normal generator of the first draw of every pair
+ */
+template<typename Normal = ziggurat::NormalPRNG>
+class AntitheticNormal {
+  public:
+    Normal normal_prng;
+
+    explicit AntitheticNormal(uint32_t seed)
+        : normal_prng(seed) {}
+
+    void set_seed(uint32_t seed) {
+        normal_prng.set_seed(seed);
+        mirrored = false;
+    }
+
+    /**
+     * @brief Standard normal PRN, every other call returns minus the previous
+     * one
+     */
+    inline float normal(void) {
+        if (mirrored) {
+            mirrored = false;
+            return -last;
+        }
+        mirrored = true;
+        last = normal_prng.normal();
+        return last;
+    }
+
+    inline float normal(float mean, float std_deviation) {
+        return mean + normal() * std_deviation;
+    }
+
+    /**
+     * @brief a new normal PRN and its mirror image
+     */
+    inline void pair(float* z, float* mirror) {
+        *z = normal_prng.normal();
+        *mirror = -*z;
+    }
+
+  private:
+    float last = 0;
+    bool mirrored = false;
+};
+
+/**
+ * @class CommonStreams
+ * @brief Hands out identical generators to competing evaluations of the
+ * same scenario
+ *
+ * stream(s) is the base generator advanced by s jumps (2^64 draws each), so
+ * scenarios never overlap as long as each uses fewer than 2^64 numbers.
+ * Asking for the scenarios in increasing order costs one jump per new
+ * scenario, going back restarts from the base.
+ *
+ * @tparam Generator Xoroshiro128plus, VXoroshiro128plus or a class derived
+ * from them
+ */
+template<typename Generator = Xoroshiro128plus>
+class CommonStreams {
+  public:
+    explicit CommonStreams(uint64_t seed)
+        : base(seed),
+          cached(base) {}
+
+    /**
+     * @brief copy of the generator of scenario s, the same for every call
+     */
+    Generator stream(uint32_t scenario) {
+        if (scenario < cached_scenario) {
+            cached = base;
+            cached_scenario = 0;
+        }
+        for (; cached_scenario < scenario; cached_scenario++) cached.jump();
+        return cached;
+    }
+
+    /**
+     * @brief normal generator drawing from the substream of scenario s
+     * (Generator must be Xoroshiro128plus)
+     */
+    template<typename Normal = ziggurat::NormalPRNG>
+    Normal normal_stream(uint32_t scenario) {
+        Normal gen(0);
+        gen.fast_prng.prng = stream(scenario);
+        gen.fast_prng.generate();
+        return gen;
+    }
+
+  private:
+    Generator base;
+    Generator cached;
+    uint32_t cached_scenario = 0;
+};
+} // namespace distributions
+} // namespace math
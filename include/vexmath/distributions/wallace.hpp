@@ -0,0 +1,234 @@
+/**
+ * @file
+ * @brief Wallace's pool based normal generator (Fast pseudorandom generators
+ * for normal and exponential variates, ACM TOMS 1996), with the improvements
+ * suggested by Brent (Some comments on C. S. Wallace's random number
+ * generators, 2008).
+ *
+ * A pool of normals is returned as is, then refreshed by applying the
+ * orthogonal 4x4 transform x' = (a + b + c + d) / 2 - x to quadruples picked
+ * with random strides and offsets. An orthogonal transform of independent
+ * normals gives independent normals, so the refresh needs only adds and
+ * multiplies: 16 normals cost 4 loads, 4 stores, a dozen NEON arithmetic
+ * instructions and one vector of random bits for sign flips.
+ *
+ * The transform preserves the sum of squares of the pool, which would
+ * otherwise be constant. Every refresh draws a chi-square variate with
+ * PoolSize degrees of freedom (Wilson-Hilferty, from a fresh Box-Muller
+ * normal: one taken from the pool would already have been returned, and
+ * the scale of a block would depend on it) and scales the returned values so
+ * that their sum of squares follows it. A Box-Muller step gives 8 normals,
+ * which are kept for the next 8 refreshes, so the log and sincos it costs
+ * are paid once every 8 pools.
+ */
+
+#pragma once
+
+#include "vexmath/distributions/box_muller.hpp"
+#include "vexmath/distributions/shared.hpp"
+#include <cstddef>
+#include <math.h>
+
+namespace math {
+namespace distributions {
+/**
+ * @class WallacePRNG
+ * @brief Normal PRN generator, same interface as ziggurat::NormalPRNG
+ *
+ * Constructor from a seed, set_seed, normal(), normal(mean, sd),
+ * exponential() and random_int31(), plus normal4() and fill().
+ *
+ * @tparam PoolSize number of normals in the pool (power of two, >= 64)
+ * @tparam Passes transform passes per refresh, the outputs of a single pass
+ * are slightly correlated with the previous pool
+ */
+template<uint32_t PoolSize = 1024, int Passes = 2>
+class WallacePRNG {
+    static_assert(PoolSize >= 64 && (PoolSize & (PoolSize - 1)) == 0,
+                  "WallacePRNG pool size must be a power of two >= 64");
+    static_assert(Passes >= 1, "WallacePRNG needs at least one pass");
+
+    /* vectors of 4 floats in each quarter of the pool */
+    static constexpr uint32_t quarter = PoolSize / 16;
+
+  public:
+    /** fills the pool, refreshes it and draws the stride and sign bits, the
+     * normals of the chi-square variates and the bits of random_int31 */
+    VBoxMuller uniform_prng;
+
+    explicit WallacePRNG(uint32_t seed)
+        : uniform_prng(seed) {
+        init();
+    }
+
+    void set_seed(uint32_t seed) {
+        uniform_prng.setSeed(seed);
+        init();
+    }
+
+    /**
+     * @brief Standard normal PRN
+     */
+    inline float normal(void) {
+        if (position == PoolSize) refresh();
+        return pool[position++] * scale;
+    }
+
+    inline float normal(float mean, float std_deviation) {
+        return mean + normal() * std_deviation;
+    }
+
+    /**
+     * @brief Exponentially distributed PRN with mean 1, (z0^2 + z1^2) / 2
+     * from two pool normals (a chi-square with 2 degrees of freedom)
+     */
+    inline float exponential(void) {
+        const float z0 = normal(), z1 = normal();
+        return 0.5f * (z0 * z0 + z1 * z1);
+    }
+
+    /**
+     * @brief uniformly distributed PRN in [0, 2^31 - 1], taken one lane at a
+     * time from uniform_prng
+     */
+    inline int32_t random_int31() {
+        if (bits_position == 4) {
+            vst1q_u32(bits, uniform_prng.next());
+            bits_position = 0;
+        }
+        return bits[bits_position++] & 0x7fffffff;
+    }
+
+    /**
+     * @brief 4 independent standard normal PRNs
+     */
+    inline float32x4_t normal4() {
+        if (position + 4 > PoolSize) refresh();
+        float32x4_t z = vmulq_n_f32(vld1q_f32(pool + position), scale);
+        position += 4;
+        return z;
+    }
+
+    /**
+     * @brief Fills out with n normal PRNs with the given mean and std
+     * deviation
+     */
+    void fill(float* out, size_t n, float mean = 0, float std_deviation = 1) {
+        const float32x4_t vmean = vdupq_n_f32(mean);
+        size_t i = 0;
+        while (i < n) {
+            if (position + 4 > PoolSize) refresh();
+            const float k = scale * std_deviation;
+            /* copy as much of the pool as possible in one go */
+            for (; i + 4 <= n && position + 4 <= PoolSize; i += 4, position += 4) {
+                vst1q_f32(out + i, vmlaq_n_f32(vmean, vld1q_f32(pool + position), k));
+            }
+            for (; i < n && i + 4 > n; i++) out[i] = normal(mean, std_deviation);
+        }
+    }
+
+  private:
+    alignas(16) float pool[PoolSize];
+    uint32_t position;
+    float scale;
+    /* Box-Muller normals left for the chi-square variates */
+    alignas(16) float chi_normals[8];
+    uint32_t chi_position;
+    alignas(16) uint32_t bits[4];
+    uint32_t bits_position;
+
+    void init() {
+        chi_position = 8;
+        bits_position = 4;
+        uniform_prng.fill(pool, PoolSize);
+        /* start from a pool with sum of squares PoolSize, the chi-square
+         * correction accounts for it */
+        double sum = 0;
+        for (uint32_t i = 0; i < PoolSize; i++) sum += pool[i] * pool[i];
+        const float k = sqrtf(PoolSize / sum);
+        for (uint32_t i = 0; i < PoolSize; i++) pool[i] *= k;
+        refresh();
+    }
+
+    /**
+     * @brief Transforms the whole pool and draws a new output scale
+     */
+    void refresh() {
+        /* normal for the chi-square variate, independent of every output */
+        if (chi_position == 8) {
+            float32x4_t z0, z1;
+            uniform_prng.normal8(&z0, &z1);
+            vst1q_f32(chi_normals, z0);
+            vst1q_f32(chi_normals + 4, z1);
+            chi_position = 0;
+        }
+        const float z = chi_normals[chi_position++];
+
+        const uint32x4_t sign = vdupq_n_u32(0x80000000u);
+        float32x4_t squares = vdupq_n_f32(0);
+        for (int pass = 0; pass < Passes; pass++) {
+            /* quarter k is read at (stride_k * i + offset_k) mod quarter,
+             * a permutation since the strides are odd */
+            uint32_t stride[4], offset[4];
+            vst1q_u32(stride, vorrq_u32(uniform_prng.next(), vdupq_n_u32(1)));
+            vst1q_u32(offset, uniform_prng.next());
+            for (int k = 0; k < 4; k++) offset[k] &= quarter - 1;
+
+            for (uint32_t i = 0; i < quarter; i++) {
+                float* p0 = pool + 4 * offset[0];
+                float* p1 = pool + 4 * (quarter + offset[1]);
+                float* p2 = pool + 4 * (2 * quarter + offset[2]);
+                float* p3 = pool + 4 * (3 * quarter + offset[3]);
+                for (int k = 0; k < 4; k++) offset[k] = (offset[k] + stride[k]) & (quarter - 1);
+
+                /* lanes are rotated so that they don't only mix with the
+                 * same lane of the other quarters, and the signs are flipped
+                 * at random (both are orthogonal too) */
+                uint32x4_t bits = uniform_prng.next();
+                float32x4_t a = vld1q_f32(p0);
+                float32x4_t b = vld1q_f32(p1);
+                float32x4_t c = vld1q_f32(p2);
+                float32x4_t d = vld1q_f32(p3);
+                b = vextq_f32(b, b, 1);
+                c = vextq_f32(c, c, 2);
+                d = vextq_f32(d, d, 3);
+                a = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vandq_u32(bits, sign)));
+                b = vreinterpretq_f32_u32(
+                  veorq_u32(vreinterpretq_u32_f32(b), vandq_u32(vshlq_n_u32(bits, 1), sign)));
+                c = vreinterpretq_f32_u32(
+                  veorq_u32(vreinterpretq_u32_f32(c), vandq_u32(vshlq_n_u32(bits, 2), sign)));
+                d = vreinterpretq_f32_u32(
+                  veorq_u32(vreinterpretq_u32_f32(d), vandq_u32(vshlq_n_u32(bits, 3), sign)));
+
+                float32x4_t t = vmulq_n_f32(vaddq_f32(vaddq_f32(a, b), vaddq_f32(c, d)), 0.5f);
+                a = vsubq_f32(t, a);
+                b = vsubq_f32(t, b);
+                c = vsubq_f32(t, c);
+                d = vsubq_f32(t, d);
+                vst1q_f32(p0, a);
+                vst1q_f32(p1, b);
+                vst1q_f32(p2, c);
+                vst1q_f32(p3, d);
+                if (pass == Passes - 1) {
+                    /* tracks the rounding drift of the sum of squares */
+                    squares = vmlaq_f32(squares, a, a);
+                    squares = vmlaq_f32(squares, b, b);
+                    squares = vmlaq_f32(squares, c, c);
+                    squares = vmlaq_f32(squares, d, d);
+                }
+            }
+        }
+        const float sum_squares = vgetq_lane_f32(squares, 0) + vgetq_lane_f32(squares, 1) +
+                                  vgetq_lane_f32(squares, 2) + vgetq_lane_f32(squares, 3);
+
+        /* chi-square with PoolSize degrees of freedom (Wilson-Hilferty):
+         * PoolSize w^3 with w = 1 - 2/(9 PoolSize) + z sqrt(2/(9 PoolSize)) */
+        constexpr float h = 2.0f / (9.0f * PoolSize);
+        float w = 1 - h + z * sqrtf(h);
+        float chi2 = PoolSize * w * w * w;
+        scale = sqrtf(chi2 / sum_squares);
+        position = 0;
+    }
+};
+} // namespace distributions
+} // namespace math
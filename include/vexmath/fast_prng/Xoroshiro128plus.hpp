@@ -124,6 +124,27 @@ class Xoroshiro128plus {
         state[3] = s3;
     }
 
+    /* Returns a child generator that continues from the current state, then
+       jumps this generator 2^64 calls ahead. Every child gets its own block
+       of 2^64 numbers that neither the parent nor later children reach, so
+       libraries can spawn independent streams without coordination. */
+
+    Xoroshiro128plus split(void) {
+        Xoroshiro128plus child(*this);
+        jump();
+        return child;
+    }
+
+    /* Same as split() with long_jump(): the child owns 2^96 numbers, enough
+       to split() it 2^32 times in turn (e.g. one long_split() per task, then
+       one split() per object of that task). */
+
+    Xoroshiro128plus long_split(void) {
+        Xoroshiro128plus child(*this);
+        long_jump();
+        return child;
+    }
+
     // needed for satisfying UniformRandomBitGenerator
     using result_type = uint32_t;
 
@@ -45,7 +45,7 @@ class VXoroshiro128plus {
                               seed_generator.next(),
                               seed_generator.next() };
 
-            s.val[i] = vld1q_u32(a);
+            s2.val[i] = vld1q_u32(a);
             s.val[i] = vld1q_u32(b);
         }
     }
@@ -78,7 +78,7 @@ class VXoroshiro128plus {
         s2.val[2] ^= s2.val[0];
 
         s.val[3]  ^= s.val[1];
-        s2.val[3] ^= s.val[1];
+        s2.val[3] ^= s2.val[1];
 
         s.val[1]  ^= s.val[2];
         s2.val[1] ^= s2.val[2];
@@ -107,33 +107,16 @@ class VXoroshiro128plus {
 
     /* This is the jump function for the generator. It is equivalent
        to 2^64 calls to next(); it can be used to generate 2^64
-       non-overlapping subsequences for parallel computations. */
+       non-overlapping subsequences for parallel computations. Both the
+       next() and the double_next() states are advanced. */
 
     void jump(void) {
         static const uint32_t JUMP[] = { 0x8764000b,
                                          0xf542d2d3,
                                          0x6fa035c3,
                                          0x77f2db5b };
-
-        uint32x4_t s0 = vdupq_n_u32(0);
-        uint32x4_t s1 = vdupq_n_u32(0);
-        uint32x4_t s2 = vdupq_n_u32(0);
-        uint32x4_t s3 = vdupq_n_u32(0);
-        for (int i = 0; i < sizeof JUMP / sizeof *JUMP; i++)
-            for (int b = 0; b < 32; b++) {
-                if (JUMP[i] & UINT32_C(1) << b) {
-                    s0 ^= s.val[0];
-                    s1 ^= s.val[1];
-                    s2 ^= s.val[2];
-                    s3 ^= s.val[3];
-                }
-                next();
-            }
-
-        s.val[0] = s0;
-        s.val[1] = s1;
-        s.val[2] = s2;
-        s.val[3] = s3;
+        jump_state(s, JUMP);
+        jump_state(s2, JUMP);
     }
 
     /* This is the long-jump function for the generator. It is equivalent to
@@ -146,26 +129,58 @@ class VXoroshiro128plus {
                                               0x0b6f099f,
                                               0xccf5a0ef,
                                               0x1c580662 };
+        jump_state(s, LONG_JUMP);
+        jump_state(s2, LONG_JUMP);
+    }
 
-        uint32x4_t s0 = vmovq_n_u32(0);
-        uint32x4_t s1 = vmovq_n_u32(0);
-        uint32x4_t s2 = vmovq_n_u32(0);
-        uint32x4_t s3 = vmovq_n_u32(0);
-        for (int i = 0; i < sizeof LONG_JUMP / sizeof *LONG_JUMP; i++)
+    /* Returns a child generator that continues from the current state, then
+       jumps this generator 2^64 calls ahead, see Xoroshiro128plus::split().
+       Every lane of the child is independent from every lane of the parent
+       and of the other children. */
+
+    VXoroshiro128plus split(void) {
+        VXoroshiro128plus child(*this);
+        jump();
+        return child;
+    }
+
+    /* Same as split() with long_jump(), for hierarchical splits */
+
+    VXoroshiro128plus long_split(void) {
+        VXoroshiro128plus child(*this);
+        long_jump();
+        return child;
+    }
+
+  protected:
+    /* applies the jump polynomial to one of the two states, one step of
+       the generator per bit */
+    static void jump_state(uint32x4x4_t& state, const uint32_t (&poly)[4]) {
+        uint32x4_t s0 = vdupq_n_u32(0);
+        uint32x4_t s1 = vdupq_n_u32(0);
+        uint32x4_t s2 = vdupq_n_u32(0);
+        uint32x4_t s3 = vdupq_n_u32(0);
+        for (int i = 0; i < 4; i++)
             for (int b = 0; b < 32; b++) {
-                if (LONG_JUMP[i] & UINT32_C(1) << b) {
-                    s0 ^= s.val[0];
-                    s1 ^= s.val[1];
-                    s2 ^= s.val[2];
-                    s3 ^= s.val[3];
+                if (poly[i] & UINT32_C(1) << b) {
+                    s0 ^= state.val[0];
+                    s1 ^= state.val[1];
+                    s2 ^= state.val[2];
+                    s3 ^= state.val[3];
                 }
-                next();
+                uint32x4_t t = vshlq_n_u32(state.val[1], 9);
+                state.val[2] ^= state.val[0];
+                state.val[3] ^= state.val[1];
+                state.val[1] ^= state.val[2];
+                state.val[0] ^= state.val[3];
+                state.val[2] ^= t;
+                state.val[3] = vshlq_n_u32(state.val[3], 11) | vshrq_n_u32(state.val[3], 32 - 11);
             }
 
-        s.val[0] = s0;
-        s.val[1] = s1;
-        s.val[2] = s2;
-        s.val[3] = s3;
+        state.val[0] = s0;
+        state.val[1] = s1;
+        state.val[2] = s2;
+        state.val[3] = s3;
     }
 };
 
@@ -203,6 +218,19 @@ class Vuniform_int32_t : public VXoroshiro128plus {
     int32x4_t operator()() {
         return get_int();
     }
+
+    // same as VXoroshiro128plus::split(), the child keeps the bounds
+    Vuniform_int32_t split() {
+        Vuniform_int32_t child(*this);
+        jump();
+        return child;
+    }
+
+    Vuniform_int32_t long_split() {
+        Vuniform_int32_t child(*this);
+        long_jump();
+        return child;
+    }
 };
 
 class Vuniform_float32_t : public VXoroshiro128plus {
@@ -301,4 +329,17 @@ class Vuniform_float32_t : public VXoroshiro128plus {
     float32x4_t operator()() {
         return get_float();
     }
+
+    // same as VXoroshiro128plus::split(), the child keeps the bounds
+    Vuniform_float32_t split() {
+        Vuniform_float32_t child(*this);
+        jump();
+        return child;
+    }
+
+    Vuniform_float32_t long_split() {
+        Vuniform_float32_t child(*this);
+        long_jump();
+        return child;
+    }
 };
@@ -0,0 +1,117 @@
+/* NEON activation functions for small feedforward models: tanh, the
+   logistic sigmoid and softplus, 4 floats at a time and over arrays.
+
+   The accurate versions are built on exp_ps / log_ps and saturate cleanly
+   (no inf / inf, no NaN) for any finite or infinite input. The _fast
+   versions use a rational approximation of tanh instead of exp_ps, which
+   is about twice as fast for an absolute error of ~2e-5, plenty for
+   activations.
+*/
+
+#pragma once
+#include <arm_neon.h>
+#include <stddef.h>
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_map.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
+
+#define c_cephes_tanh_p0 -5.70498872745E-3
+#define c_cephes_tanh_p1 2.06390887954E-2
+#define c_cephes_tanh_p2 -5.37397155531E-2
+#define c_cephes_tanh_p3 1.33314422036E-1
+#define c_cephes_tanh_p4 -3.33332819422E-1
+
+/* hyperbolic tangent of 4 floats at once (cephes tanhf): an odd
+   polynomial for |x| < 0.625, 1 - 2 / (exp(2|x|) + 1) above. Large |x|
+   saturate to +-1 since the reciprocal of a huge exp_ps is 0. */
+inline v4sf tanh_ps(v4sf x) {
+  v4su sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+  v4sf ax = vabsq_f32(x);
+
+  v4sf z = vmulq_f32(x, x);
+  v4sf p = vdupq_n_f32(c_cephes_tanh_p0);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_tanh_p1), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_tanh_p2), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_tanh_p3), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_tanh_p4), p, z);
+  p = vmlaq_f32(x, vmulq_f32(p, z), x);
+
+  v4sf s = exp_ps(vaddq_f32(ax, ax));
+  v4sf t = vmlsq_f32(vdupq_n_f32(1), vdupq_n_f32(2), Vrecip<2>(vaddq_f32(s, vdupq_n_f32(1))));
+  t = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(t), sign));
+  return vbslq_f32(vcltq_f32(ax, vdupq_n_f32(0.625f)), p, t);
+}
+
+/* logistic sigmoid 1 / (1 + exp(-x)) of 4 floats at once, 0 below
+   x = -88 and 1 above x = 17 */
+inline v4sf sigmoid_ps(v4sf x) {
+  return Vrecip<2>(vaddq_f32(vdupq_n_f32(1), exp_ps(vnegq_f32(x))));
+}
+
+/* softplus log(1 + exp(x)) of 4 floats at once, as
+   max(x, 0) + log1p(exp(-|x|)) so that it never overflows. log1p(t) is
+   log(u) t / (u - 1) with u = 1 + t rounded, which cancels the rounding
+   of u (t itself when u rounds to 1). */
+inline v4sf softplus_ps(v4sf x) {
+  v4sf one = vdupq_n_f32(1);
+  v4sf t = exp_ps(vnegq_f32(vabsq_f32(x)));
+  v4sf u = vaddq_f32(one, t);
+  v4sf d = vsubq_f32(u, one);
+  v4sf l = vmulq_f32(log_ps(u), vmulq_f32(t, Vrecip<2>(d)));
+  l = vbslq_f32(vceqq_f32(d, vdupq_n_f32(0)), t, l);
+  return vaddq_f32(vmaxq_f32(x, vdupq_n_f32(0)), l);
+}
+
+/* rational minimax approximation of tanh on [-7.9, 7.9] (odd degree 13
+   over even degree 6, as used by Eigen), tanh rounds to +-1 beyond */
+#define c_tanh_clamp 7.90531110763549805f
+#define c_tanh_a1 4.89352455891786e-03f
+#define c_tanh_a3 6.37261928875436e-04f
+#define c_tanh_a5 1.48572235717979e-05f
+#define c_tanh_a7 5.12229709037114e-08f
+#define c_tanh_a9 -8.60467152213735e-11f
+#define c_tanh_a11 2.00018790482477e-13f
+#define c_tanh_a13 -2.76076847742355e-16f
+#define c_tanh_b0 4.89352518554385e-03f
+#define c_tanh_b2 2.26843463243900e-03f
+#define c_tanh_b4 1.18534705686654e-04f
+#define c_tanh_b6 1.19825839466702e-06f
+
+/* tanh of 4 floats at once without exp_ps, ~2e-5 error (one Newton step
+   on the reciprocal of the denominator) */
+inline v4sf tanh_fast_ps(v4sf x) {
+  x = vminq_f32(x, vdupq_n_f32(c_tanh_clamp));
+  x = vmaxq_f32(x, vdupq_n_f32(-c_tanh_clamp));
+  v4sf z = vmulq_f32(x, x);
+
+  v4sf p = vdupq_n_f32(c_tanh_a13);
+  p = vmlaq_f32(vdupq_n_f32(c_tanh_a11), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_tanh_a9), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_tanh_a7), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_tanh_a5), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_tanh_a3), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_tanh_a1), p, z);
+  p = vmulq_f32(p, x);
+
+  v4sf q = vdupq_n_f32(c_tanh_b6);
+  q = vmlaq_f32(vdupq_n_f32(c_tanh_b4), q, z);
+  q = vmlaq_f32(vdupq_n_f32(c_tanh_b2), q, z);
+  q = vmlaq_f32(vdupq_n_f32(c_tanh_b0), q, z);
+  /* the reciprocal error could push the result past +-1 */
+  v4sf t = vmulq_f32(p, Vrecip<1>(q));
+  return vmaxq_f32(vminq_f32(t, vdupq_n_f32(1)), vdupq_n_f32(-1));
+}
+
+/* sigmoid of 4 floats at once without exp_ps, 1/2 + tanh(x / 2) / 2. The
+   error is absolute: the far negative tail is ~1e-6 rather than 0. */
+inline v4sf sigmoid_fast_ps(v4sf x) {
+  v4sf half = vdupq_n_f32(0.5f);
+  return vmlaq_f32(half, half, tanh_fast_ps(vmulq_f32(x, half)));
+}
+
+/* activations over whole arrays (e.g. a layer's outputs, in place) */
+inline void tanh_array(float *out, const float *in, size_t n) { map_ps(tanh_ps, out, in, n); }
+inline void sigmoid_array(float *out, const float *in, size_t n) { map_ps(sigmoid_ps, out, in, n); }
+inline void softplus_array(float *out, const float *in, size_t n) { map_ps(softplus_ps, out, in, n); }
+inline void tanh_fast_array(float *out, const float *in, size_t n) { map_ps(tanh_fast_ps, out, in, n); }
+inline void sigmoid_fast_array(float *out, const float *in, size_t n) { map_ps(sigmoid_fast_ps, out, in, n); }
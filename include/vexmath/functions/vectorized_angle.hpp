@@ -0,0 +1,100 @@
+/* NEON angle wrapping for odometry and heading control: angles wrapped
+   to [-Pi, Pi) or [0, 2Pi) and the shortest signed difference between
+   two angles, in radians or in degrees (pros::Imu headings and
+   rotations), 4 floats at a time and over arrays.
+
+   x loses k periods, with k = x / period rounded to the nearest integer
+   by a multiply with 1 / period and the 1.5 * 2^23 trick: no division,
+   no fmod and no loop. 2 Pi is subtracted in 2 parts, the first one
+   exact for |k| < 2^16 (|x| < 4e5 rad), which keeps the absolute error
+   around 1e-6 however many turns x holds. 360 needs no split. Rounding
+   can leave the result one ulp outside of the range, which two selects
+   fix.
+
+   The rounding trick needs |x| < 2^22 periods (2.6e7 rad, 1.5e9
+   degrees), inf and NaN give NaN.
+*/
+
+#pragma once
+#include <arm_neon.h>
+#include <stddef.h>
+#include "vexmath/functions/vectorized_map.hpp"
+
+typedef float32x4_t v4sf;  // vector of 4 float
+typedef uint32x4_t v4su;  // vector of 4 uint32
+
+#define c_angle_round_magic 12582912.0f  // 1.5 * 2^23
+#define c_angle_PI 3.14159265358979323846f
+#define c_angle_2PI 6.28318530717958647693f
+#define c_angle_INV2PI 0.15915494309189533577f
+#define c_angle_2PI_hi 6.28125f
+#define c_angle_2PI_lo 1.9353071795864769e-3f  // 2 Pi - 6.28125
+#define c_angle_INV360 2.77777777777777777778e-3f
+
+/* t rounded to the nearest integer (ties to even) for |t| < 2^22: the
+   sum with 1.5 * 2^23 has no fractional bits left */
+inline v4sf round_nearest_ps(v4sf t) {
+  v4sf magic = vdupq_n_f32(c_angle_round_magic);
+  return vsubq_f32(vaddq_f32(t, magic), magic);
+}
+
+/* moves r into [lo, lo + period) when rounding left it just outside */
+inline v4sf angle_fixup_ps(v4sf r, float lo, float period) {
+  v4sf vlo = vdupq_n_f32(lo), vperiod = vdupq_n_f32(period);
+  r = vbslq_f32(vcltq_f32(r, vlo), vaddq_f32(r, vperiod), r);
+  r = vbslq_f32(vcgeq_f32(r, vaddq_f32(vlo, vperiod)), vsubq_f32(r, vperiod), r);
+  return r;
+}
+
+/* x - 2 Pi k, the 2 parts of 2 Pi subtracted in turn */
+inline v4sf angle_reduce_2pi_ps(v4sf x, v4sf k) {
+  x = vmlsq_n_f32(x, k, c_angle_2PI_hi);
+  return vmlsq_n_f32(x, k, c_angle_2PI_lo);
+}
+
+/* angles wrapped to [-Pi, Pi) */
+inline v4sf wrap_pi_ps(v4sf x) {
+  v4sf k = round_nearest_ps(vmulq_n_f32(x, c_angle_INV2PI));
+  return angle_fixup_ps(angle_reduce_2pi_ps(x, k), -c_angle_PI, c_angle_2PI);
+}
+
+/* angles wrapped to [0, 2 Pi) */
+inline v4sf wrap_2pi_ps(v4sf x) {
+  v4sf k = round_nearest_ps(vmlaq_n_f32(vdupq_n_f32(-0.5f), x, c_angle_INV2PI));
+  return angle_fixup_ps(angle_reduce_2pi_ps(x, k), 0, c_angle_2PI);
+}
+
+/* shortest signed rotation from b to a, in [-Pi, Pi) */
+inline v4sf angle_diff_ps(v4sf a, v4sf b) {
+  return wrap_pi_ps(vsubq_f32(a, b));
+}
+
+/* angles in degrees wrapped to [-180, 180) */
+inline v4sf wrap_180_ps(v4sf x) {
+  v4sf k = round_nearest_ps(vmulq_n_f32(x, c_angle_INV360));
+  return angle_fixup_ps(vmlsq_n_f32(x, k, 360), -180, 360);
+}
+
+/* angles in degrees wrapped to [0, 360), like pros::Imu::get_heading */
+inline v4sf wrap_360_ps(v4sf x) {
+  v4sf k = round_nearest_ps(vmlaq_n_f32(vdupq_n_f32(-0.5f), x, c_angle_INV360));
+  return angle_fixup_ps(vmlsq_n_f32(x, k, 360), 0, 360);
+}
+
+/* shortest signed rotation from b to a in degrees, in [-180, 180) */
+inline v4sf angle_diff_deg_ps(v4sf a, v4sf b) {
+  return wrap_180_ps(vsubq_f32(a, b));
+}
+
+/* the same over whole arrays (e.g. the headings of a trajectory, in
+   place), out[i] = angle_diff(a[i], b[i]) for the differences */
+inline void wrap_pi_array(float *out, const float *in, size_t n) { map_ps(wrap_pi_ps, out, in, n); }
+inline void wrap_2pi_array(float *out, const float *in, size_t n) { map_ps(wrap_2pi_ps, out, in, n); }
+inline void wrap_180_array(float *out, const float *in, size_t n) { map_ps(wrap_180_ps, out, in, n); }
+inline void wrap_360_array(float *out, const float *in, size_t n) { map_ps(wrap_360_ps, out, in, n); }
+inline void angle_diff_array(float *out, const float *a, const float *b, size_t n) {
+  map2_ps(angle_diff_ps, out, a, b, n);
+}
+inline void angle_diff_deg_array(float *out, const float *a, const float *b, size_t n) {
+  map2_ps(angle_diff_deg_ps, out, a, b, n);
+}
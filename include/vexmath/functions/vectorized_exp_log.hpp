@@ -28,6 +28,8 @@
 
 #pragma once
 #include <arm_neon.h>
+#include <math.h>
+#include "vexmath/functions/vectorized_sqrt.hpp"
 
 typedef float32x4_t v4sf;  // vector of 4 float
 typedef uint32x4_t v4su;  // vector of 4 uint32
@@ -195,3 +197,184 @@ inline v4sf exp_ps(v4sf x) {
   return y;
 }
 
+
+#define c_exp2_hi 127.4999f
+#define c_exp2_lo -127.0f
+
+#define c_cephes_exp2_p0 1.535336188319500E-4
+#define c_cephes_exp2_p1 1.339887440266574E-3
+#define c_cephes_exp2_p2 9.618437357674640E-3
+#define c_cephes_exp2_p3 5.550332471162809E-2
+#define c_cephes_exp2_p4 2.402264791363012E-1
+#define c_cephes_exp2_p5 6.931472028550421E-1
+
+/* 2^x computed for 4 float at once, rewriting of the cephes exp2f
+   function: 2^x = 2^n 2^g with n = round(x) and |g| <= 1/2, 2^g from its
+   own minimax polynomial, so unlike exp_ps(x ln2) there is no rounding
+   of the product and integer x gives exact powers of two. */
+inline v4sf exp2_ps(v4sf x) {
+  v4sf one = vdupq_n_f32(1);
+  x = vminq_f32(x, vdupq_n_f32(c_exp2_hi));
+  x = vmaxq_f32(x, vdupq_n_f32(c_exp2_lo));
+
+  /* n = floorf(x + 0.5) */
+  v4sf fx = vaddq_f32(x, vdupq_n_f32(0.5f));
+  v4sf tmp = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+  v4su mask = vandq_u32(vcgtq_f32(tmp, fx), vreinterpretq_u32_f32(one));
+  fx = vsubq_f32(tmp, vreinterpretq_f32_u32(mask));
+  x = vsubq_f32(x, fx);
+
+  v4sf y = vdupq_n_f32(c_cephes_exp2_p0);
+  y = vmlaq_f32(vdupq_n_f32(c_cephes_exp2_p1), y, x);
+  y = vmlaq_f32(vdupq_n_f32(c_cephes_exp2_p2), y, x);
+  y = vmlaq_f32(vdupq_n_f32(c_cephes_exp2_p3), y, x);
+  y = vmlaq_f32(vdupq_n_f32(c_cephes_exp2_p4), y, x);
+  y = vmlaq_f32(vdupq_n_f32(c_cephes_exp2_p5), y, x);
+  y = vmlaq_f32(one, y, x);
+
+  /* build 2^n */
+  int32x4_t mm = vcvtq_s32_f32(fx);
+  mm = vaddq_s32(mm, vdupq_n_s32(0x7f));
+  mm = vshlq_n_s32(mm, 23);
+  return vmulq_f32(y, vreinterpretq_f32_s32(mm));
+}
+
+/* reduction shared by log2_ps and log10_ps, the one of log_ps: x = 2^e m
+   with sqrt(1/2) <= m < sqrt(2), returns f = m - 1 and *y = log(1 + f) - f
+   from the cephes logf polynomial, so that the caller can scale f and y
+   by split constants. */
+inline v4sf log_reduce_ps(v4sf x, v4sf *e, v4sf *y) {
+  v4sf one = vdupq_n_f32(1);
+  v4si ux = vreinterpretq_s32_f32(x);
+  v4si emm0 = vshrq_n_s32(ux, 23);
+
+  /* keep only the fractional part */
+  ux = vandq_s32(ux, vdupq_n_s32(c_inv_mant_mask));
+  ux = vorrq_s32(ux, vreinterpretq_s32_f32(vdupq_n_f32(0.5f)));
+  x = vreinterpretq_f32_s32(ux);
+  *e = vaddq_f32(vcvtq_f32_s32(vsubq_s32(emm0, vdupq_n_s32(0x7f))), one);
+
+  v4su mask = vcltq_f32(x, vdupq_n_f32(c_cephes_SQRTHF));
+  v4sf tmp = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(x), mask));
+  x = vsubq_f32(x, one);
+  *e = vsubq_f32(*e, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(one), mask)));
+  x = vaddq_f32(x, tmp);
+
+  v4sf z = vmulq_f32(x,x);
+  v4sf p = vdupq_n_f32(c_cephes_log_p0);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p1), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p2), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p3), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p4), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p5), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p6), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p7), p, x);
+  p = vmlaq_f32(vdupq_n_f32(c_cephes_log_p8), p, x);
+  p = vmulq_f32(vmulq_f32(p, x), z);
+  *y = vmlsq_f32(p, z, vdupq_n_f32(0.5f));
+  return x;
+}
+
+#define c_cephes_LOG2EA 0.44269504088896340736  // log2(e) - 1
+#define c_cephes_L10EA 4.3359375E-1  // log10(e), split in two
+#define c_cephes_L10EB 7.00731903251827651129E-4
+#define c_cephes_L102A 3.0078125E-1  // log10(2), split in two
+#define c_cephes_L102B 2.48745663981195213739E-4
+
+/* base 2 logarithm computed for 4 float at once (cephes log2f), NaN for
+   x <= 0 like log_ps. log(1 + f) is scaled by log2(e) = 1 + LOG2EA with
+   the 1 applied exactly, and e is added last, so log2_ps(2^k) = k exactly.
+*/
+inline v4sf log2_ps(v4sf x) {
+  x = vmaxq_f32(x, vdupq_n_f32(0)); /* force flush to zero on denormal values */
+  v4su invalid_mask = vcleq_f32(x, vdupq_n_f32(0));
+  v4sf e, y;
+  v4sf f = log_reduce_ps(x, &e, &y);
+
+  v4sf z = vmulq_n_f32(y, c_cephes_LOG2EA);
+  z = vmlaq_n_f32(z, f, c_cephes_LOG2EA);
+  z = vaddq_f32(z, y);
+  z = vaddq_f32(z, f);
+  z = vaddq_f32(z, e);
+  return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(z), invalid_mask));
+}
+
+/* base 10 logarithm computed for 4 float at once (cephes log10f), NaN for
+   x <= 0. log10(e) and log10(2) are split in a short head and a tail so
+   that the products with the exponent are exact. */
+inline v4sf log10_ps(v4sf x) {
+  x = vmaxq_f32(x, vdupq_n_f32(0)); /* force flush to zero on denormal values */
+  v4su invalid_mask = vcleq_f32(x, vdupq_n_f32(0));
+  v4sf e, y;
+  v4sf f = log_reduce_ps(x, &e, &y);
+
+  v4sf z = vmulq_n_f32(y, c_cephes_L10EB);
+  z = vmlaq_n_f32(z, f, c_cephes_L10EB);
+  z = vmlaq_n_f32(z, e, c_cephes_L102B);
+  z = vmlaq_n_f32(z, y, c_cephes_L10EA);
+  z = vmlaq_n_f32(z, f, c_cephes_L10EA);
+  z = vmlaq_n_f32(z, e, c_cephes_L102A);
+  return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(z), invalid_mask));
+}
+
+/* x^n for an integer n, by repeated squaring: exact for small n as long
+   as the result fits (x * x is correctly rounded), about log2(n) ulp
+   otherwise. Negative n take the reciprocal at the end. */
+inline v4sf powi_ps(v4sf x, int n) {
+  unsigned m = n < 0 ? -(unsigned)n : n;
+  v4sf y = vdupq_n_f32(1);
+  while (m) {
+    if (m & 1) y = vmulq_f32(y, x);
+    m >>= 1;
+    if (m) x = vmulq_f32(x, x);
+  }
+  return n < 0 ? Vrecip<2>(y) : y;
+}
+
+/* x^y computed for 4 pairs at once, as 2^(y log2|x|).
+
+   The relative error grows with |y log2 x| (about 2^-24 per unit of the
+   exponent), as for any pow built on a float log.
+   Integer exponents are handled per lane: a negative x gives a negative
+   result for odd y and NaN for a non-integer y, x = 0 gives 0 for y > 0
+   and inf for y < 0 (the reverse for x = inf), and y = 0 gives 1 for every
+   x. Like exp_ps, results past the float range saturate to about 2^127.5.
+
+   When all 4 exponents are the same integer with |y| <= 16, powi_ps is
+   used instead, so that pow_ps(x, 2) is exactly x * x. That path follows
+   plain float multiplication: results past the float range are +-inf (and
+   0 for negative y) rather than saturated.
+*/
+inline v4sf pow_ps(v4sf x, v4sf y) {
+  float y0 = vgetq_lane_f32(y, 0);
+  if (y0 >= -16 && y0 <= 16 && y0 == (int)y0) {
+    uint32x4_t same = vceqq_f32(y, vdupq_n_f32(y0));
+    uint32x2_t m = vand_u32(vget_low_u32(same), vget_high_u32(same));
+    if (vget_lane_u32(vpmin_u32(m, m), 0)) return powi_ps(x, (int)y0);
+  }
+
+  v4sf zero = vdupq_n_f32(0);
+  v4sf ax = vabsq_f32(x);
+  v4sf r = exp2_ps(vmulq_f32(y, log2_ps(ax)));
+
+  /* y integer (always the case for |y| >= 2^23), odd when y / 2 isn't
+     (never the case for |y| >= 2^24, odd integers stop there) */
+  v4sf ty = vcvtq_f32_s32(vcvtq_s32_f32(y));
+  v4su big = vcgeq_f32(vabsq_f32(y), vdupq_n_f32(16777216.0f));
+  v4su integer = vorrq_u32(vceqq_f32(ty, y), big);
+  v4sf half = vmulq_n_f32(y, 0.5f);
+  v4su odd = vbicq_u32(integer, vorrq_u32(vceqq_f32(vcvtq_f32_s32(vcvtq_s32_f32(half)), half), big));
+
+  /* x = 0 or inf: 0 or inf depending on the sign of y, with the sign of x
+     for odd y */
+  v4su xinf = vceqq_f32(ax, vdupq_n_f32(INFINITY));
+  v4su edge = vorrq_u32(vceqq_f32(ax, zero), xinf);
+  v4su to_inf = veorq_u32(vcltq_f32(y, zero), xinf);
+  r = vbslq_f32(edge, vbslq_f32(to_inf, vdupq_n_f32(INFINITY), zero), r);
+
+  v4su negative = vcltq_f32(x, zero);
+  v4su sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+  r = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(r), vandq_u32(sign, odd)));
+  r = vbslq_f32(vbicq_u32(negative, integer), vdupq_n_f32(NAN), r);
+  return vbslq_f32(vceqq_f32(y, zero), vdupq_n_f32(1), r);
+}
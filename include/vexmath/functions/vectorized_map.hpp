@@ -0,0 +1,39 @@
+/* Applies a function of 4 floats to whole arrays, the last 1 to 3
+   elements through a padded copy so that no load or store goes past the
+   end of the arrays.
+*/
+
+#pragma once
+#include <arm_neon.h>
+#include <stddef.h>
+
+/* applies f to the n floats of in, 4 at a time. in and out may be the
+   same array. */
+template<typename F>
+inline void map_ps(F f, float *out, const float *in, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) vst1q_f32(out + i, f(vld1q_f32(in + i)));
+  if (i < n) {
+    float tmp[4] = { 0, 0, 0, 0 };
+    for (size_t j = 0; i + j < n; j++) tmp[j] = in[i + j];
+    vst1q_f32(tmp, f(vld1q_f32(tmp)));
+    for (size_t j = 0; i + j < n; j++) out[i + j] = tmp[j];
+  }
+}
+
+/* out[i] = f(a[i], b[i]) for the n floats of a and b, 4 at a time. out
+   may be the same array as a or b. */
+template<typename F>
+inline void map2_ps(F f, float *out, const float *a, const float *b, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) vst1q_f32(out + i, f(vld1q_f32(a + i), vld1q_f32(b + i)));
+  if (i < n) {
+    float tmp_a[4] = { 0, 0, 0, 0 }, tmp_b[4] = { 0, 0, 0, 0 };
+    for (size_t j = 0; i + j < n; j++) {
+      tmp_a[j] = a[i + j];
+      tmp_b[j] = b[i + j];
+    }
+    vst1q_f32(tmp_a, f(vld1q_f32(tmp_a), vld1q_f32(tmp_b)));
+    for (size_t j = 0; i + j < n; j++) out[i + j] = tmp_a[j];
+  }
+}
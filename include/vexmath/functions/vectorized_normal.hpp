@@ -0,0 +1,257 @@
+/* NEON implementation of the normal distribution functions: quantile,
+   erf / erfc, CDF, density and log-density
+
+   The quantile maps 4 probabilities to 4 standard normal values at once,
+   so that uniforms from any generator (quasi-random sequences, antithetic
+   pairs u / 1 - u, stratified samples) can be turned into normals by
+   inversion, which the ziggurat can't do. The others are meant for
+   likelihoods, e.g. weighting particles by sensor readings.
+*/
+
+#pragma once
+#include <arm_neon.h>
+#include <math.h>
+#include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
+
+/* Wichura's algorithm AS 241 (The percentage points of the normal
+   distribution, 1988), single precision version PPND7, accurate to about
+   1e-7. Acklam's approximation is more accurate in double but its central
+   rational function cancels in float near the tails (~1e-4 relative error),
+   the PPND7 polynomials have well conditioned coefficients.
+   central region |q| <= 0.425, q = p - 1/2:
+     x = q A(r) / B(r) with r = 0.180625 - q^2
+   tails, r = sqrt(-log(min(p, 1 - p))):
+     x = +-C(r - 1.6) / D(r - 1.6) for r <= 5
+     x = +-E(r - 5) / F(r - 5) further out (p < 1.4e-11) */
+#define c_ppnd7_split1 0.425f
+#define c_ppnd7_const1 0.180625f
+#define c_ppnd7_split2 5.0f
+#define c_ppnd7_const2 1.6f
+
+#define c_ppnd7_a0 3.3871327179E+00
+#define c_ppnd7_a1 5.0434271938E+01
+#define c_ppnd7_a2 1.5929113202E+02
+#define c_ppnd7_a3 5.9109374720E+01
+#define c_ppnd7_b1 1.7895169469E+01
+#define c_ppnd7_b2 7.8757757664E+01
+#define c_ppnd7_b3 6.7187563600E+01
+
+#define c_ppnd7_c0 1.4234372777E+00
+#define c_ppnd7_c1 2.7568153900E+00
+#define c_ppnd7_c2 1.3067284816E+00
+#define c_ppnd7_c3 1.7023821103E-01
+#define c_ppnd7_d1 7.3700164250E-01
+#define c_ppnd7_d2 1.2021132975E-01
+
+#define c_ppnd7_e0 6.6579051150E+00
+#define c_ppnd7_e1 3.0812263860E+00
+#define c_ppnd7_e2 4.2868294337E-01
+#define c_ppnd7_e3 1.7337203997E-02
+#define c_ppnd7_f1 2.4197894225E-01
+#define c_ppnd7_f2 1.2258202635E-02
+
+#define c_min_norm_pos 1.17549435e-38f
+
+/* inverse of the standard normal CDF computed for 4 float at once.
+   p <= 0 gives -inf, p >= 1 gives +inf and NaN stays NaN. Every region is
+   evaluated on every lane and selected, so there is no data-dependent branch:
+   the two tail polynomials share one evaluation with per-lane coefficients,
+   and a single reciprocal serves both rational functions.
+*/
+inline v4sf normal_icdf_ps(v4sf p) {
+  v4sf one = vdupq_n_f32(1);
+  v4sf q = vsubq_f32(p, vdupq_n_f32(0.5f));
+  v4su central = vcleq_f32(vabsq_f32(q), vdupq_n_f32(c_ppnd7_split1));
+
+  /* central region, the numerator is multiplied by q below */
+  v4sf r = vmlsq_f32(vdupq_n_f32(c_ppnd7_const1), q, q);
+  v4sf num = vdupq_n_f32(c_ppnd7_a3);
+  num = vmlaq_f32(vdupq_n_f32(c_ppnd7_a2), num, r);
+  num = vmlaq_f32(vdupq_n_f32(c_ppnd7_a1), num, r);
+  num = vmlaq_f32(vdupq_n_f32(c_ppnd7_a0), num, r);
+  v4sf den = vdupq_n_f32(c_ppnd7_b3);
+  den = vmlaq_f32(vdupq_n_f32(c_ppnd7_b2), den, r);
+  den = vmlaq_f32(vdupq_n_f32(c_ppnd7_b1), den, r);
+  den = vmlaq_f32(one, den, r);
+
+  /* tails, on min(p, 1 - p) (1 - p is exact for p > 1/2). The argument of
+     the log is kept normal since NEON flushes denormals to zero, and the
+     square root is Vsqrt<2>, on t >= log(2) */
+  v4sf m = vminq_f32(p, vsubq_f32(one, p));
+  m = vmaxq_f32(m, vdupq_n_f32(c_min_norm_pos));
+  v4sf t = vnegq_f32(log_ps(m));
+  t = Vsqrt<2>(t);
+
+  v4su far = vcgtq_f32(t, vdupq_n_f32(c_ppnd7_split2));
+  t = vsubq_f32(t, vbslq_f32(far, vdupq_n_f32(c_ppnd7_split2), vdupq_n_f32(c_ppnd7_const2)));
+  v4sf tnum = vbslq_f32(far, vdupq_n_f32(c_ppnd7_e3), vdupq_n_f32(c_ppnd7_c3));
+  tnum = vmlaq_f32(vbslq_f32(far, vdupq_n_f32(c_ppnd7_e2), vdupq_n_f32(c_ppnd7_c2)), tnum, t);
+  tnum = vmlaq_f32(vbslq_f32(far, vdupq_n_f32(c_ppnd7_e1), vdupq_n_f32(c_ppnd7_c1)), tnum, t);
+  tnum = vmlaq_f32(vbslq_f32(far, vdupq_n_f32(c_ppnd7_e0), vdupq_n_f32(c_ppnd7_c0)), tnum, t);
+  v4sf tden = vbslq_f32(far, vdupq_n_f32(c_ppnd7_f2), vdupq_n_f32(c_ppnd7_d2));
+  tden = vmlaq_f32(vbslq_f32(far, vdupq_n_f32(c_ppnd7_f1), vdupq_n_f32(c_ppnd7_d1)), tden, t);
+  tden = vmlaq_f32(one, tden, t);
+
+  /* x = q A / B in the center, sign(q) C / D in the tails */
+  v4sf sign = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(q), vdupq_n_u32(0x80000000u)),
+                                              vreinterpretq_u32_f32(one)));
+  num = vmulq_f32(vbslq_f32(central, num, tnum), vbslq_f32(central, q, sign));
+  den = vbslq_f32(central, den, tden);
+
+  v4sf x = Vdiv<2>(num, den);
+
+  v4sf inf = vdupq_n_f32(INFINITY);
+  x = vbslq_f32(vcleq_f32(p, vdupq_n_f32(0)), vnegq_f32(inf), x);
+  x = vbslq_f32(vcgeq_f32(p, one), inf, x);
+  return x;
+}
+
+/* cephes erff / erfcf coefficients:
+     erf(x) = x T(x^2) for |x| < 1
+     erfc(x) = exp(-x^2) / x P(1 / x^2) for 1 <= x < 2, R(1 / x^2) above
+   R has one coefficient less, padded with a leading 0 so that both share
+   one evaluation with per-lane coefficients */
+#define c_erf_t0 7.853861353153693E-5
+#define c_erf_t1 -8.010193625184903E-4
+#define c_erf_t2 5.188327685732524E-3
+#define c_erf_t3 -2.685381193529856E-2
+#define c_erf_t4 1.128358514861418E-1
+#define c_erf_t5 -3.761262582423300E-1
+#define c_erf_t6 1.128379165726710E+0
+
+#define c_erfc_p0 2.326819970068386E-2
+#define c_erfc_p1 -1.387039388740657E-1
+#define c_erfc_p2 3.687424674597105E-1
+#define c_erfc_p3 -5.824733027278666E-1
+#define c_erfc_p4 6.210004621745983E-1
+#define c_erfc_p5 -4.944515323274145E-1
+#define c_erfc_p6 3.404879937665872E-1
+#define c_erfc_p7 -2.741127028184656E-1
+#define c_erfc_p8 5.638259427386472E-1
+
+#define c_erfc_r0 0.0
+#define c_erfc_r1 -1.047766399936249E+1
+#define c_erfc_r2 1.297719955372516E+1
+#define c_erfc_r3 -7.495518717768503E+0
+#define c_erfc_r4 2.921019019210786E+0
+#define c_erfc_r5 -1.015265279202700E+0
+#define c_erfc_r6 4.218463358204948E-1
+#define c_erfc_r7 -2.820767439740514E-1
+#define c_erfc_r8 5.641895067754075E-1
+
+#define c_erfc_underflow 9.194f  // erfc(x) < FLT_MIN above
+#define c_SQRTH 0.70710678118654752440
+#define c_INV_SQRT_2PI 0.39894228040143267794
+#define c_LOG_SQRT_2PI 0.91893853320467274178
+
+/* exp(-k a^2) for a >= 0 and k = 1 or 1/2, without the rounding of a^2
+   (cephes expx2f): a = m + f with m a multiple of 1/128, so that k m^2
+   is exact, and exp(-k a^2) = exp(-k m^2) exp(-k (2m + f) f). Otherwise
+   the relative error would grow like a^2 2^-24, 5e-6 at a = 9. */
+inline v4sf exp_neg_sq_ps(v4sf a, float k) {
+  v4sf m = vcvtq_f32_s32(vcvtq_s32_f32(vmlaq_n_f32(vdupq_n_f32(0.5f), a, 128)));
+  m = vmulq_n_f32(m, 1.0f / 128);
+  v4sf f = vsubq_f32(a, m);
+  v4sf u = vmulq_n_f32(vmulq_f32(m, m), -k);
+  v4sf u1 = vmulq_n_f32(vmulq_f32(vmlaq_n_f32(f, m, 2), f), -k);
+  return vmulq_f32(exp_ps(u), exp_ps(u1));
+}
+
+/* x T(x^2), erf for |x| < 1 */
+inline v4sf erf_small_ps(v4sf x) {
+  v4sf z = vmulq_f32(x, x);
+  v4sf y = vdupq_n_f32(c_erf_t0);
+  y = vmlaq_f32(vdupq_n_f32(c_erf_t1), y, z);
+  y = vmlaq_f32(vdupq_n_f32(c_erf_t2), y, z);
+  y = vmlaq_f32(vdupq_n_f32(c_erf_t3), y, z);
+  y = vmlaq_f32(vdupq_n_f32(c_erf_t4), y, z);
+  y = vmlaq_f32(vdupq_n_f32(c_erf_t5), y, z);
+  y = vmlaq_f32(vdupq_n_f32(c_erf_t6), y, z);
+  return vmulq_f32(x, y);
+}
+
+/* erfc for a >= 1, given e = exp(-a^2) (computed by the caller, which may
+   know a more accurate form of it) */
+inline v4sf erfc_tail_ps(v4sf a, v4sf e) {
+  v4su far = vcgeq_f32(a, vdupq_n_f32(2));
+  v4sf q = Vrecip<2>(a);
+  v4sf z = vmulq_f32(q, q);
+#define ERFC_COEF(i) vbslq_f32(far, vdupq_n_f32(c_erfc_r##i), vdupq_n_f32(c_erfc_p##i))
+  v4sf p = ERFC_COEF(0);
+  p = vmlaq_f32(ERFC_COEF(1), p, z);
+  p = vmlaq_f32(ERFC_COEF(2), p, z);
+  p = vmlaq_f32(ERFC_COEF(3), p, z);
+  p = vmlaq_f32(ERFC_COEF(4), p, z);
+  p = vmlaq_f32(ERFC_COEF(5), p, z);
+  p = vmlaq_f32(ERFC_COEF(6), p, z);
+  p = vmlaq_f32(ERFC_COEF(7), p, z);
+  p = vmlaq_f32(ERFC_COEF(8), p, z);
+#undef ERFC_COEF
+  v4sf y = vmulq_f32(vmulq_f32(e, q), p);
+  return vbslq_f32(vcgeq_f32(a, vdupq_n_f32(c_erfc_underflow)), vdupq_n_f32(0), y);
+}
+
+/* error function of 4 floats at once, ~2e-7 relative error */
+inline v4sf erf_ps(v4sf x) {
+  v4sf a = vabsq_f32(x);
+  v4sf big = vsubq_f32(vdupq_n_f32(1), erfc_tail_ps(a, exp_neg_sq_ps(a, 1)));
+  big = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(big),
+                                        vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u))));
+  return vbslq_f32(vcltq_f32(a, vdupq_n_f32(1)), erf_small_ps(x), big);
+}
+
+/* complementary error function 1 - erf(x) of 4 floats at once. The
+   relative error is below 1e-6 (worst just under x = 1, where erfc is
+   1 - erf) down to the smallest normal float around x = 9.19, 0 beyond */
+inline v4sf erfc_ps(v4sf x) {
+  v4sf one = vdupq_n_f32(1);
+  v4sf a = vabsq_f32(x);
+  v4sf y = vbslq_f32(vcltq_f32(a, one), vsubq_f32(one, erf_small_ps(a)),
+                     erfc_tail_ps(a, exp_neg_sq_ps(a, 1)));
+  return vbslq_f32(vcltq_f32(x, vdupq_n_f32(0)), vsubq_f32(vdupq_n_f32(2), y), y);
+}
+
+/* standard normal CDF of 4 floats at once, erfc(-x / sqrt(2)) / 2 with
+   exp(-x^2 / 2) taken from x itself, so that the lower tail keeps its
+   relative precision down to x = -13 (FLT_MIN) */
+inline v4sf normal_cdf_ps(v4sf x) {
+  v4sf one = vdupq_n_f32(1);
+  v4sf ax = vabsq_f32(x);
+  v4sf a = vmulq_n_f32(ax, c_SQRTH);
+  v4sf y = vbslq_f32(vcltq_f32(a, one), vsubq_f32(one, erf_small_ps(a)),
+                     erfc_tail_ps(a, exp_neg_sq_ps(ax, 0.5f)));
+  /* y = erfc(|x| / sqrt(2)), the upper tail is 1 - y / 2 */
+  y = vmulq_n_f32(y, 0.5f);
+  return vbslq_f32(vcgtq_f32(x, vdupq_n_f32(0)), vsubq_f32(one, y), y);
+}
+
+inline v4sf normal_cdf_ps(v4sf x, v4sf mu, v4sf inv_sigma) {
+  return normal_cdf_ps(vmulq_f32(vsubq_f32(x, mu), inv_sigma));
+}
+
+/* standard normal density of 4 floats at once */
+inline v4sf normal_pdf_ps(v4sf x) {
+  return vmulq_n_f32(exp_neg_sq_ps(vabsq_f32(x), 0.5f), c_INV_SQRT_2PI);
+}
+
+inline v4sf normal_pdf_ps(v4sf x, v4sf mu, v4sf inv_sigma) {
+  return vmulq_f32(normal_pdf_ps(vmulq_f32(vsubq_f32(x, mu), inv_sigma)), inv_sigma);
+}
+
+/* log of the normal density, -z^2 / 2 + log(inv_sigma) - log(sqrt(2 pi))
+   with z = (x - mu) inv_sigma: a subtraction and three multiply-adds, no
+   exp, so likelihoods can be accumulated in log space. The float
+   inv_sigma version, for a sigma shared by the 4 lanes, computes
+   log(inv_sigma) with one scalar logf instead of log_ps. */
+inline v4sf normal_logpdf_ps(v4sf x, v4sf mu, v4sf inv_sigma) {
+  v4sf z = vmulq_f32(vsubq_f32(x, mu), inv_sigma);
+  v4sf c = vsubq_f32(log_ps(inv_sigma), vdupq_n_f32(c_LOG_SQRT_2PI));
+  return vmlsq_f32(c, vmulq_n_f32(z, 0.5f), z);
+}
+
+inline v4sf normal_logpdf_ps(v4sf x, v4sf mu, float inv_sigma) {
+  v4sf z = vmulq_n_f32(vsubq_f32(x, mu), inv_sigma);
+  v4sf c = vdupq_n_f32(logf(inv_sigma) - (float)c_LOG_SQRT_2PI);
+  return vmlsq_f32(c, vmulq_n_f32(z, 0.5f), z);
+}
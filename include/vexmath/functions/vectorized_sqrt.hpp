@@ -1,8 +1,10 @@
 #pragma once
 
 #include <arm_neon.h>
+#include <math.h>
 
-// vectorized fast inverse square root
+// vectorized fast inverse square root (Quake magic constant and one Newton
+// step, about 0.2% error). Vrsqrt below is both faster and more accurate
 inline float32x4_t V_rsqrt(float32x4_t number) {
     uint32x4_t i;
     float32x4_t x2, y;
@@ -14,7 +16,7 @@ inline float32x4_t V_rsqrt(float32x4_t number) {
     y = number;
     i = vreinterpretq_u32_f32(y); // evil floating point bit level hacking
     i = magic_number - vshrq_n_u32(i, 1); // what the fuck?
-    y = vreinterpretq_f32_u32(y);
+    y = vreinterpretq_f32_u32(i);
     y = y * (threehalfs - (x2 * y * y)); // 1st iteration
     //	y  = y * ( threehalfs - ( x2 * y * y ) );   // 2nd iteration, this can
     // be removed
@@ -22,13 +24,78 @@ inline float32x4_t V_rsqrt(float32x4_t number) {
     return y;
 }
 
+/*
+ * Precision tiers built on the NEON estimates. vrsqrteq_f32 and vrecpeq_f32
+ * are good to about 8 bits, and each Newton step (vrsqrtsq_f32 /
+ * vrecpsq_f32) roughly doubles that. On ARMv7 the step instructions round
+ * the product before subtracting it, so the second step stops a few ulp
+ * short of full float precision:
+ *   Steps = 0: ~8 bits, Steps = 1: ~16 bits, Steps = 2: ~21 bits
+ * The cost is one multiply and one step instruction per step for the
+ * reciprocal, two multiplies and one step for the reciprocal square root.
+ */
+
+/**
+ * @brief Reciprocal square root 1/sqrt(x)
+ *
+ * 1/sqrt(0) = inf and 1/sqrt(inf) = 0 for every tier (the Newton step
+ * would otherwise compute 0 * inf), negative inputs give NaN.
+ *
+ * @tparam Steps Newton steps after the estimate, 0 to 2
+ */
+template<int Steps = 2>
+inline float32x4_t Vrsqrt(float32x4_t x) {
+    static_assert(Steps >= 0 && Steps <= 2, "Vrsqrt takes 0 to 2 Newton steps");
+    const float32x4_t estimate = vrsqrteq_f32(x);
+    if (Steps == 0) return estimate;
+
+    /* (x * r) * r rather than x * (r * r), which underflows for x > 2^126 */
+    float32x4_t r = estimate;
+    for (int i = 0; i < Steps; i++) r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(x, r), r));
+    const uint32x4_t special =
+      vorrq_u32(vceqq_f32(x, vdupq_n_f32(0)), vceqq_f32(x, vdupq_n_f32(INFINITY)));
+    return vbslq_f32(special, estimate, r);
+}
+
+/**
+ * @brief Square root, as x * rsqrt(x)
+ *
+ * sqrt(0) = 0 and sqrt(inf) = inf for every tier, negative inputs give NaN.
+ *
+ * @tparam Steps Newton steps of the reciprocal square root, 0 to 2
+ */
+template<int Steps = 2>
+inline float32x4_t Vsqrt(float32x4_t x) {
+    const uint32x4_t special =
+      vorrq_u32(vceqq_f32(x, vdupq_n_f32(0)), vceqq_f32(x, vdupq_n_f32(INFINITY)));
+    return vbslq_f32(special, x, vmulq_f32(x, Vrsqrt<Steps>(x)));
+}
+
 /**
- * @brief Returns square root of vector of numbers. Only an approximation, don't
- * use if precision is needed
+ * @brief Reciprocal 1/x
+ *
+ * 1/+-0 = +-inf and 1/+-inf = +-0 (the step instruction returns 2 for
+ * 0 * inf). |x| >= 2^126 gives 0, NEON flushes denormal results.
+ *
+ * @tparam Steps Newton steps after the estimate, 0 to 2
+ */
+template<int Steps = 2>
+inline float32x4_t Vrecip(float32x4_t x) {
+    static_assert(Steps >= 0 && Steps <= 2, "Vrecip takes 0 to 2 Newton steps");
+    float32x4_t r = vrecpeq_f32(x);
+    for (int i = 0; i < Steps; i++) r = vmulq_f32(r, vrecpsq_f32(x, r));
+    return r;
+}
+
+/**
+ * @brief Quotient a / b, as a * (1/b)
+ *
+ * About one more ulp of error than the reciprocal at Steps = 2. x / 0 gives
+ * a signed infinity, 0 / 0 and inf / inf give NaN.
  *
- * @param number input vector
- * @return square root of vector
+ * @tparam Steps Newton steps of the reciprocal, 0 to 2
  */
-inline float32x4_t Vsqrt(float32x4_t number) {
-    return number * V_rsqrt(number);
+template<int Steps = 2>
+inline float32x4_t Vdiv(float32x4_t a, float32x4_t b) {
+    return vmulq_f32(a, Vrecip<Steps>(b));
 }
@@ -27,6 +27,8 @@
 
 #pragma once
 #include <arm_neon.h>
+#include <assert.h>
+#include "vexmath/functions/vectorized_sqrt.hpp"
 
 typedef float32x4_t v4sf;  // vector of 4 float
 typedef uint32x4_t v4su;  // vector of 4 uint32
@@ -42,30 +44,46 @@ typedef int32x4_t v4si;  // vector of 4 uint32
 #define c_coscof_p1 -1.388731625493765E-003
 #define c_coscof_p2  4.166664568298827E-002
 #define c_cephes_FOPI 1.27323954473516 // 4 / M_PI
+#define c_cephes_PIO2F 1.5707963267948966192
+#define c_cephes_PIO4F 0.7853981633974483096
+#define c_cephes_PIF 3.141592653589793238
 
-/* evaluation of 4 sines & cosines at once.
+/* minimax coefficients of the reduced precision tiers of sincos_ps, on
+   |x| <= Pi/4 (absolute error):
+     Degree 3: sin ~ x (s1 + s3 x^2), cos ~ c0 + c2 x^2            2e-3
+     Degree 5: sin ~ x (s1 + s3 x^2 + s5 x^4), cos ~ c0 + c2 x^2 + c4 x^4  1e-5
+   Degree 7 is the cephes pair (sine of degree 7, cosine of degree 8). */
+#define c_sincos3_s1 0.9990314229131482
+#define c_sincos3_s3 -0.16034401672335621
+#define c_sincos3_c0 0.9980784990150391
+#define c_sincos3_c2 -0.47482060177589175
+#define c_sincos5_s1 0.9999949975616435
+#define c_sincos5_s3 -0.1666016198823577
+#define c_sincos5_s5 0.008121557924631671
+#define c_sincos5_c0 0.9999900349553448
+#define c_sincos5_c2 -0.49970814035693445
+#define c_sincos5_c4 0.04039853596906776
+#define c_minus_PIO4F -0.78539816339744830962
+#define c_minus_cephes_DP23 -2.4191339744830963e-4  // DP2 + DP3
+#define c_minus_PIO4F_hi -0.785398185253143310546875  // (float)(Pi/4)
+#define c_minus_PIO4F_lo 2.1855695000931214e-8  // (float)(Pi/4) - Pi/4
+/* largest |x| accepted by sincos_ps_bounded and sincos_ps_pio4, a few ulps
+   above Pi and Pi/4 so that wrapped angles rounded up still pass */
+#define c_sincos_bounded_max 3.1416f
+#define c_sincos_pio4_max 0.7854f
 
-   The code is the exact rewriting of the cephes sinf function.
-   Precision is excellent as long as x < 8192 (I did not bother to
-   take into account the special handling they have for greater values
-   -- it does not return garbage for arguments over 8192, though, but
-   the extra precision is missing).
+/* range reduction shared by sincos_ps and tan_ps.
 
-   Note that it is such that sinf((float)M_PI) = 8.74e-8, which is the
-   surprising but correct result.
-
-   Note also that when you compute sin(x), cos(x) is available at
-   almost no extra price so both sin_ps and cos_ps make use of
-   sincos_ps..
-  */
-inline void sincos_ps(v4sf x, v4sf *ysin, v4sf *ycos) { // any x
-  v4sf xmm1, xmm2, xmm3, y;
+   Takes x >= 0, returns the octant j (even, cephes' j=(j+1) & (~1)) and
+   *r = x - j Pi/4 in [-Pi/4, Pi/4]. Pi/4 is subtracted in 3 parts for
+   Degree 7, in 2 parts for Degree 5 and in one for Degree 3, which is
+   accurate enough for their tier up to |x| ~ 1e4.
+*/
+template<int Degree>
+inline v4su sincos_octant_ps(v4sf x, v4sf *r) {
+  v4sf y;
 
   v4su emm2;
-  
-  v4su sign_mask_sin, sign_mask_cos;
-  sign_mask_sin = vcltq_f32(x, vdupq_n_f32(0));
-  x = vabsq_f32(x);
 
   /* scale by 4/Pi */
   y = vmulq_f32(x, vdupq_n_f32(c_cephes_FOPI));
@@ -77,6 +95,84 @@ inline void sincos_ps(v4sf x, v4sf *ysin, v4sf *ycos) { // any x
   emm2 = vandq_u32(emm2, vdupq_n_u32(~1));
   y = vcvtq_f32_u32(emm2);
 
+  /* The magic pass: "Extended precision modular arithmetic" 
+     x = ((x - y * DP1) - y * DP2) - y * DP3; */
+  if (Degree == 3) {
+    x = vaddq_f32(x, vmulq_n_f32(y, c_minus_PIO4F));
+  } else if (Degree == 5) {
+    x = vaddq_f32(x, vmulq_n_f32(y, c_minus_cephes_DP1));
+    x = vaddq_f32(x, vmulq_n_f32(y, c_minus_cephes_DP23));
+  } else {
+    v4sf xmm1, xmm2, xmm3;
+    xmm1 = vmulq_n_f32(y, c_minus_cephes_DP1);
+    xmm2 = vmulq_n_f32(y, c_minus_cephes_DP2);
+    xmm3 = vmulq_n_f32(y, c_minus_cephes_DP3);
+    x = vaddq_f32(x, xmm1);
+    x = vaddq_f32(x, xmm2);
+    x = vaddq_f32(x, xmm3);
+  }
+  *r = x;
+  return emm2;
+}
+
+/* the cosine (*y1) and sine (*y2) polynomials of tier Degree on the
+   reduced argument */
+template<int Degree>
+inline void sincos_poly_ps(v4sf x, v4sf *y1, v4sf *y2) {
+  v4sf z = vmulq_f32(x,x);
+  if (Degree == 3) {
+    *y1 = vmlaq_n_f32(vdupq_n_f32(c_sincos3_c0), z, c_sincos3_c2);
+    *y2 = vmulq_f32(vmlaq_n_f32(vdupq_n_f32(c_sincos3_s1), z, c_sincos3_s3), x);
+    return;
+  }
+  if (Degree == 5) {
+    *y1 = vmlaq_n_f32(vdupq_n_f32(c_sincos5_c2), z, c_sincos5_c4);
+    *y1 = vmlaq_f32(vdupq_n_f32(c_sincos5_c0), *y1, z);
+    *y2 = vmlaq_n_f32(vdupq_n_f32(c_sincos5_s3), z, c_sincos5_s5);
+    *y2 = vmulq_f32(vmlaq_f32(vdupq_n_f32(c_sincos5_s1), *y2, z), x);
+    return;
+  }
+
+  /* Evaluate the first polynom  (0 <= x <= Pi/4) in y1, 
+     and the second polynom      (Pi/4 <= x <= 0) in y2 */
+  *y1 = vmulq_n_f32(z, c_coscof_p0);
+  *y2 = vmulq_n_f32(z, c_sincof_p0);
+  *y1 = vaddq_f32(*y1, vdupq_n_f32(c_coscof_p1));
+  *y2 = vaddq_f32(*y2, vdupq_n_f32(c_sincof_p1));
+  *y1 = vmulq_f32(*y1, z);
+  *y2 = vmulq_f32(*y2, z);
+  *y1 = vaddq_f32(*y1, vdupq_n_f32(c_coscof_p2));
+  *y2 = vaddq_f32(*y2, vdupq_n_f32(c_sincof_p2));
+  *y1 = vmulq_f32(*y1, z);
+  *y2 = vmulq_f32(*y2, z);
+  *y1 = vmulq_f32(*y1, z);
+  *y2 = vmulq_f32(*y2, x);
+  *y1 = vsubq_f32(*y1, vmulq_f32(z, vdupq_n_f32(0.5f)));
+  *y2 = vaddq_f32(*y2, x);
+  *y1 = vaddq_f32(*y1, vdupq_n_f32(1));
+}
+
+/* full precision reduction and polynomials, for tan_ps */
+inline v4su sincos_reduce_ps(v4sf x, v4sf *y1, v4sf *y2) {
+  v4sf r;
+  v4su emm2 = sincos_octant_ps<7>(x, &r);
+  sincos_poly_ps<7>(r, y1, y2);
+  return emm2;
+}
+
+/* evaluation of 4 sines & cosines at once, with a choice of precision:
+   sincos_ps<3> (~2e-3 absolute error) and sincos_ps<5> (~1e-5) save
+   multiply-adds in the reduction and the polynomials over sincos_ps<7>,
+   which is the full precision sincos_ps below. */
+template<int Degree>
+inline void sincos_ps(v4sf x, v4sf *ysin, v4sf *ycos) { // any x
+  static_assert(Degree == 3 || Degree == 5 || Degree == 7, "sincos_ps tiers are 3, 5 and 7");
+  v4sf r, y1, y2;
+  v4su sign_mask_sin, sign_mask_cos;
+  sign_mask_sin = vcltq_f32(x, vdupq_n_f32(0));
+  v4su emm2 = sincos_octant_ps<Degree>(vabsq_f32(x), &r);
+  sincos_poly_ps<Degree>(r, &y1, &y2);
+
   /* get the polynom selection mask 
      there is one polynom for 0 <= x <= Pi/4
      and another one for Pi/4<x<=Pi/2
@@ -84,40 +180,10 @@ inline void sincos_ps(v4sf x, v4sf *ysin, v4sf *ycos) { // any x
      Both branches will be computed.
   */
   v4su poly_mask = vtstq_u32(emm2, vdupq_n_u32(2));
-  
-  /* The magic pass: "Extended precision modular arithmetic" 
-     x = ((x - y * DP1) - y * DP2) - y * DP3; */
-  xmm1 = vmulq_n_f32(y, c_minus_cephes_DP1);
-  xmm2 = vmulq_n_f32(y, c_minus_cephes_DP2);
-  xmm3 = vmulq_n_f32(y, c_minus_cephes_DP3);
-  x = vaddq_f32(x, xmm1);
-  x = vaddq_f32(x, xmm2);
-  x = vaddq_f32(x, xmm3);
 
   sign_mask_sin = veorq_u32(sign_mask_sin, vtstq_u32(emm2, vdupq_n_u32(4)));
   sign_mask_cos = vtstq_u32(vsubq_u32(emm2, vdupq_n_u32(2)), vdupq_n_u32(4));
 
-  /* Evaluate the first polynom  (0 <= x <= Pi/4) in y1, 
-     and the second polynom      (Pi/4 <= x <= 0) in y2 */
-  v4sf z = vmulq_f32(x,x);
-  v4sf y1, y2;
-
-  y1 = vmulq_n_f32(z, c_coscof_p0);
-  y2 = vmulq_n_f32(z, c_sincof_p0);
-  y1 = vaddq_f32(y1, vdupq_n_f32(c_coscof_p1));
-  y2 = vaddq_f32(y2, vdupq_n_f32(c_sincof_p1));
-  y1 = vmulq_f32(y1, z);
-  y2 = vmulq_f32(y2, z);
-  y1 = vaddq_f32(y1, vdupq_n_f32(c_coscof_p2));
-  y2 = vaddq_f32(y2, vdupq_n_f32(c_sincof_p2));
-  y1 = vmulq_f32(y1, z);
-  y2 = vmulq_f32(y2, z);
-  y1 = vmulq_f32(y1, z);
-  y2 = vmulq_f32(y2, x);
-  y1 = vsubq_f32(y1, vmulq_f32(z, vdupq_n_f32(0.5f)));
-  y2 = vaddq_f32(y2, x);
-  y1 = vaddq_f32(y1, vdupq_n_f32(1));
-
   /* select the correct result from the two polynoms */  
   v4sf ys = vbslq_f32(poly_mask, y1, y2);
   v4sf yc = vbslq_f32(poly_mask, y2, y1);
@@ -125,6 +191,25 @@ inline void sincos_ps(v4sf x, v4sf *ysin, v4sf *ycos) { // any x
   *ycos = vbslq_f32(sign_mask_cos, yc, vnegq_f32(yc));
 }
 
+/* evaluation of 4 sines & cosines at once.
+
+   The code is the exact rewriting of the cephes sinf function.
+   Precision is excellent as long as x < 8192 (I did not bother to
+   take into account the special handling they have for greater values
+   -- it does not return garbage for arguments over 8192, though, but
+   the extra precision is missing).
+
+   Note that it is such that sinf((float)M_PI) = 8.74e-8, which is the
+   surprising but correct result.
+
+   Note also that when you compute sin(x), cos(x) is available at
+   almost no extra price so both sin_ps and cos_ps make use of
+   sincos_ps..
+  */
+inline void sincos_ps(v4sf x, v4sf *ysin, v4sf *ycos) { // any x
+  sincos_ps<7>(x, ysin, ycos);
+}
+
 inline v4sf sin_ps(v4sf x) {
   v4sf ysin, ycos; 
   sincos_ps(x, &ysin, &ycos); 
@@ -136,3 +221,200 @@ inline v4sf cos_ps(v4sf x) {
   sincos_ps(x, &ysin, &ycos); 
   return ycos;
 }
+
+/* false when a lane has |x| > bound (NaN lanes pass), for the range
+   assertions of the bounded variants below. Those are only compiled in
+   with -DVEXMATH_DEBUG (PROS builds don't define NDEBUG, and the check
+   would otherwise cost as much as the reduction it saves). */
+inline bool sincos_in_range_ps(v4sf x, float bound) {
+  v4su out = vcgtq_f32(vabsq_f32(x), vdupq_n_f32(bound));
+  uint32x2_t any = vorr_u32(vget_low_u32(out), vget_high_u32(out));
+  return (vget_lane_u32(any, 0) | vget_lane_u32(any, 1)) == 0;
+}
+
+/* sincos_ps for angles already wrapped to |x| <= Pi, same tiers.
+
+   The octant can only be 0, 2 or 4, so it is found with two comparisons
+   instead of the 4/Pi scaling and the float -> int -> float round trip,
+   and j Pi/4 is subtracted in 2 parts: j (float)(Pi/4) is exact for
+   j <= 4 and so is its difference with x (Sterbenz), which leaves the low
+   part as the only rounding. Degree 3 subtracts Pi/4 in one part like
+   sincos_ps<3>. Larger |x| give wrong results, and trip an assertion when
+   VEXMATH_DEBUG is defined.
+*/
+template<int Degree = 7>
+inline void sincos_ps_bounded(v4sf x, v4sf *ysin, v4sf *ycos) { // |x| <= Pi
+  static_assert(Degree == 3 || Degree == 5 || Degree == 7, "sincos_ps tiers are 3, 5 and 7");
+#ifdef VEXMATH_DEBUG
+  assert(sincos_in_range_ps(x, c_sincos_bounded_max) && "sincos_ps_bounded takes |x| <= Pi");
+#endif
+  v4sf ax = vabsq_f32(x);
+  v4su past_pio4 = vcgeq_f32(ax, vdupq_n_f32(c_cephes_PIO4F));
+  v4su past_3pio4 = vcgeq_f32(ax, vdupq_n_f32(3 * c_cephes_PIO4F));
+  v4sf j = vbslq_f32(past_3pio4, vdupq_n_f32(4),
+                     vbslq_f32(past_pio4, vdupq_n_f32(2), vdupq_n_f32(0)));
+
+  v4sf r, y1, y2;
+  if (Degree == 3) {
+    r = vmlaq_n_f32(ax, j, c_minus_PIO4F);
+  } else {
+    r = vmlaq_n_f32(ax, j, c_minus_PIO4F_hi);
+    r = vmlaq_n_f32(r, j, c_minus_PIO4F_lo);
+  }
+  sincos_poly_ps<Degree>(r, &y1, &y2);
+
+  /* same selection as sincos_ps: the polynomials swap for j = 2, the sine
+     changes sign for j = 4 and the cosine for j = 2 and 4 */
+  v4su poly_mask = vbicq_u32(past_pio4, past_3pio4);
+  v4su sign_mask_sin = veorq_u32(vcltq_f32(x, vdupq_n_f32(0)), past_3pio4);
+  v4sf ys = vbslq_f32(poly_mask, y1, y2);
+  v4sf yc = vbslq_f32(poly_mask, y2, y1);
+  *ysin = vbslq_f32(sign_mask_sin, vnegq_f32(ys), ys);
+  *ycos = vbslq_f32(past_pio4, vnegq_f32(yc), yc);
+}
+
+/* sincos_ps for |x| <= Pi/4: no reduction at all, only the polynomials
+   of tier Degree */
+template<int Degree = 7>
+inline void sincos_ps_pio4(v4sf x, v4sf *ysin, v4sf *ycos) { // |x| <= Pi/4
+  static_assert(Degree == 3 || Degree == 5 || Degree == 7, "sincos_ps tiers are 3, 5 and 7");
+#ifdef VEXMATH_DEBUG
+  assert(sincos_in_range_ps(x, c_sincos_pio4_max) && "sincos_ps_pio4 takes |x| <= Pi/4");
+#endif
+  sincos_poly_ps<Degree>(x, ycos, ysin);
+}
+
+/* tangent of 4 floats at once, same range reduction and polynomials as
+   sincos_ps. On the reduced argument r, tan(x) = sin(r) / cos(r) when the
+   octant is a multiple of Pi, and -cos(r) / sin(r) otherwise, so one
+   quotient is enough (Vdiv<2>).
+
+   Near the poles the divisor is sin(r) with r small, which the reduction
+   keeps accurate: tan_ps((float)M_PI/2) = -2.29e7 like tanf. A divisor of
+   exactly +-0 gives +-inf (the Newton step of vrecpsq_f32(0, inf) is 2).
+*/
+inline v4sf tan_ps(v4sf x) {
+  v4sf y1, y2;
+  v4su sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+  v4su emm2 = sincos_reduce_ps(vabsq_f32(x), &y1, &y2);
+  v4su poly_mask = vtstq_u32(emm2, vdupq_n_u32(2));
+
+  v4sf num = vbslq_f32(poly_mask, y1, y2);
+  v4sf den = vbslq_f32(poly_mask, vnegq_f32(y2), y1);
+  v4sf y = Vdiv<2>(num, den);
+  return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(y), sign));
+}
+
+#define c_cephes_T3PO8 2.414213562373095  // tan(3 Pi / 8)
+#define c_cephes_TPO8 0.4142135623730950  // tan(Pi / 8)
+#define c_atancof_p0 8.05374449538e-2
+#define c_atancof_p1 -1.38776856032e-1
+#define c_atancof_p2 1.99777106478e-1
+#define c_atancof_p3 -3.33329491539e-1
+
+/* atan(num / den) for num, den >= 0, in [0, Pi/2].
+
+   Range reduction of cephes atanf, with the ratio never formed: for
+   num > tan(3Pi/8) den the argument is -den/num (+ Pi/2), for
+   num > tan(Pi/8) den it is (num - den)/(num + den) (+ Pi/4), otherwise
+   num/den, so a single division (Vdiv<2>) serves the three cases.
+*/
+inline v4sf atan_positive_ps(v4sf num, v4sf den) {
+  v4su big = vcgtq_f32(num, vmulq_n_f32(den, c_cephes_T3PO8));
+  v4su mid = vcgtq_f32(num, vmulq_n_f32(den, c_cephes_TPO8));
+
+  v4sf n = vbslq_f32(mid, vsubq_f32(num, den), num);
+  v4sf d = vbslq_f32(mid, vaddq_f32(num, den), den);
+  n = vbslq_f32(big, vnegq_f32(den), n);
+  d = vbslq_f32(big, num, d);
+  v4sf y = vbslq_f32(mid, vdupq_n_f32(c_cephes_PIO4F), vdupq_n_f32(0));
+  y = vbslq_f32(big, vdupq_n_f32(c_cephes_PIO2F), y);
+
+  /* 0/0 (both zero) gives 0 */
+  d = vbslq_f32(vceqq_f32(d, vdupq_n_f32(0)), vdupq_n_f32(1), d);
+  v4sf x = Vdiv<2>(n, d);
+
+  v4sf z = vmulq_f32(x, x);
+  v4sf p = vdupq_n_f32(c_atancof_p0);
+  p = vmlaq_f32(vdupq_n_f32(c_atancof_p1), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_atancof_p2), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_atancof_p3), p, z);
+  p = vmulq_f32(vmulq_f32(p, z), x);
+  return vaddq_f32(y, vaddq_f32(p, x));
+}
+
+/* arctangent of 4 floats at once, rewriting of the cephes atanf function
+   without branches. */
+inline v4sf atan_ps(v4sf x) {
+  v4su sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+  v4sf y = atan_positive_ps(vabsq_f32(x), vdupq_n_f32(1));
+  return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(y), sign));
+}
+
+/* atan2(y, x) of 4 pairs at once, in [-Pi, Pi].
+
+   The angle of (|x|, |y|) is computed in the first quadrant, then the
+   quadrant is fixed with masks: Pi - angle for x < 0, and the sign of y
+   (including -0) is copied. Like cephes atan2f, atan2(0, 0) is 0 and
+   x = -0 is treated as positive. Both arguments infinite give NaN.
+*/
+inline v4sf atan2_ps(v4sf y, v4sf x) {
+  v4su sign = vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000u));
+  v4sf a = atan_positive_ps(vabsq_f32(y), vabsq_f32(x));
+  a = vbslq_f32(vcltq_f32(x, vdupq_n_f32(0)), vsubq_f32(vdupq_n_f32(c_cephes_PIF), a), a);
+  return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), sign));
+}
+
+#define c_asincof_p0 4.2163199048E-2
+#define c_asincof_p1 2.4181311049E-2
+#define c_asincof_p2 4.5470025998E-2
+#define c_asincof_p3 7.4953002686E-2
+#define c_asincof_p4 1.6666752422E-1
+
+/* asin(a) for 0 <= a <= 1, as cephes asinf: the polynomial is only used
+   on [0, 1/2], above that asin(a) = Pi/2 - 2 asin(sqrt((1 - a) / 2)).
+   Returns the polynomial part r and the mask of the lanes where the
+   identity applies, so that asin and acos can combine them differently.
+   The square root is Vsqrt<2>, exact 0 for a = 1. */
+inline v4sf asin_reduced_ps(v4sf a, v4su *big) {
+  v4sf half = vdupq_n_f32(0.5f);
+  *big = vcgtq_f32(a, half);
+
+  v4sf zb = vmulq_f32(half, vsubq_f32(vdupq_n_f32(1), a));
+  v4sf x = vbslq_f32(*big, Vsqrt<2>(zb), a);
+  v4sf z = vbslq_f32(*big, zb, vmulq_f32(a, a));
+
+  v4sf p = vdupq_n_f32(c_asincof_p0);
+  p = vmlaq_f32(vdupq_n_f32(c_asincof_p1), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_asincof_p2), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_asincof_p3), p, z);
+  p = vmlaq_f32(vdupq_n_f32(c_asincof_p4), p, z);
+  return vmlaq_f32(x, vmulq_f32(p, z), x);
+}
+
+/* arcsine of 4 floats at once, in [-Pi/2, Pi/2]. The input is clamped to
+   [-1, 1] (rounding in a normalization often leaves it just outside)
+   instead of returning NaN like asinf. */
+inline v4sf asin_ps(v4sf x) {
+  v4su sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+  v4su big;
+  v4sf r = asin_reduced_ps(vminq_f32(vabsq_f32(x), vdupq_n_f32(1)), &big);
+  r = vbslq_f32(big, vmlsq_f32(vdupq_n_f32(c_cephes_PIO2F), vdupq_n_f32(2), r), r);
+  return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(r), sign));
+}
+
+/* arccosine of 4 floats at once, in [0, Pi], input clamped to [-1, 1].
+   Uses acos(x) = 2 asin(sqrt((1 - x) / 2)) for x > 1/2 and
+   Pi - 2 asin(sqrt((1 + x) / 2)) for x < -1/2, so that the result keeps
+   its relative precision near x = 1 instead of cancelling in Pi/2 - asin(x).
+*/
+inline v4sf acos_ps(v4sf x) {
+  v4su negative = vcltq_f32(x, vdupq_n_f32(0));
+  v4su big;
+  v4sf r = asin_reduced_ps(vminq_f32(vabsq_f32(x), vdupq_n_f32(1)), &big);
+  /* small |x|: Pi/2 - asin(x) */
+  v4sf y = vsubq_f32(vdupq_n_f32(c_cephes_PIO2F), vbslq_f32(negative, vnegq_f32(r), r));
+  v4sf r2 = vaddq_f32(r, r);
+  r2 = vbslq_f32(negative, vsubq_f32(vdupq_n_f32(c_cephes_PIF), r2), r2);
+  return vbslq_f32(big, r2, y);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @brief Minimal access to the Cortex-A9 performance monitor unit (cycle
+ * counter and one event counter) for benchmarks.
+ *
+ * PROS tasks run in a privileged mode so the CP15 registers can be accessed
+ * directly. On other targets (e.g. when building the tests on a host) every
+ * read returns 0.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace pmu {
+/** @brief Some ARMv7 common event numbers, see the Cortex-A9 TRM 11.4 */
+enum event : uint32_t {
+    L1I_REFILL = 0x01,
+    L1D_REFILL = 0x03,
+    L1D_ACCESS = 0x04,
+    INSTRUCTIONS = 0x08,
+    BRANCH_MISPREDICT = 0x10,
+};
+
+/**
+ * @brief Enables and resets the cycle counter and event counter 0
+ *
+ * @param counted event counted by event counter 0
+ */
+inline void enable(uint32_t counted = L1D_REFILL) {
+#if defined(__arm__)
+    uint32_t pmcr;
+    asm volatile("mrc p15, 0, %0, c9, c12, 0" : "=r"(pmcr));
+    pmcr |= 0x7; /* enable, reset event counters, reset cycle counter */
+    pmcr &= ~0x8u; /* count every cycle, not every 64 */
+    asm volatile("mcr p15, 0, %0, c9, c12, 0" ::"r"(pmcr));
+    asm volatile("mcr p15, 0, %0, c9, c12, 5" ::"r"(0)); /* select counter 0 */
+    asm volatile("mcr p15, 0, %0, c9, c13, 1" ::"r"(counted));
+    asm volatile("mcr p15, 0, %0, c9, c12, 1" ::"r"(0x80000001u)); /* cycle counter + counter 0 */
+#else
+    (void)counted;
+#endif
+}
+
+/** @brief Current value of the cycle counter */
+inline uint32_t cycles() {
+#if defined(__arm__)
+    uint32_t value;
+    asm volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+/** @brief Current value of event counter 0 */
+inline uint32_t events() {
+#if defined(__arm__)
+    uint32_t value;
+    asm volatile("mcr p15, 0, %0, c9, c12, 5" ::"r"(0));
+    asm volatile("mrc p15, 0, %0, c9, c13, 2" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+} // namespace pmu
@@ -0,0 +1,113 @@
+/* instrument.hpp: optional path counters and latency histogram for
+ * ZigguratPRNG.
+ *
+ * ZigguratPRNG<Layers, Tables, no_stats> (the default) compiles every hook
+ * below away. Passing ziggurat_stats instead counts how often each branch of
+ * normal()/exponential() is taken and how many cycles every outermost call
+ * took, so the tail latency can be checked against the control loop budget:
+ *
+ *     InstrumentedNormalPRNG gen(seed);
+ *     ... run the loop ...
+ *     gen.stats.print();   // stdout goes to the serial terminal
+ *
+ * Cycles come from the PMU cycle counter (see pmu.hpp), which is enabled and
+ * reset when the stats are constructed. On a host build every call lands in
+ * the first histogram bucket.
+ * */
+#pragma once
+
+#include "vexmath/pmu.hpp"
+#include <cstdint>
+#include <stdio.h>
+
+namespace math {
+namespace ziggurat {
+enum class ziggurat_path : uint8_t {
+    normal_early_exit,
+    normal_convex,     /* j > j_inflection */
+    normal_tail,       /* j == 0, also draws exponentials */
+    normal_concave,    /* 0 < j < j_inflection */
+    normal_inflection, /* j == j_inflection (or any overhang with SIMPLE_OVERHANGS) */
+    normal_rejected,   /* overhang point rejected, another one is drawn */
+    exp_early_exit,
+    exp_overhang,
+    exp_tail,          /* j == 0, recurses into exponential() */
+    exp_rejected,      /* _exp_overhang recursed */
+    count
+};
+
+/* Does nothing, used by the non instrumented generator */
+struct no_stats {
+    struct timer {
+        constexpr timer(no_stats&) {}
+    };
+
+    constexpr void hit(ziggurat_path) {}
+};
+
+struct ziggurat_stats {
+    static constexpr int histogram_buckets = 16;
+
+    uint32_t hits[static_cast<int>(ziggurat_path::count)] {};
+    /* bucket k counts the calls that took [2^k, 2^(k+1)) cycles, the last one
+     * everything above */
+    uint32_t histogram[histogram_buckets] {};
+    uint32_t calls = 0;
+    uint32_t max_cycles = 0;
+    uint32_t depth = 0; /* normal() calls exponential(), only time the outermost call */
+
+    ziggurat_stats() {
+        pmu::enable();
+    }
+
+    /* times the enclosing scope if it is not nested in another timed call */
+    struct timer {
+        ziggurat_stats& stats;
+        uint32_t start;
+
+        timer(ziggurat_stats& s)
+            : stats(s),
+              start(s.depth++ ? 0 : pmu::cycles()) {}
+
+        ~timer() {
+            if (--stats.depth == 0) stats.record(pmu::cycles() - start);
+        }
+    };
+
+    void hit(ziggurat_path path) {
+        hits[static_cast<int>(path)]++;
+    }
+
+    void record(uint32_t cycles) {
+        int bucket = 31 - __builtin_clz(cycles | 1);
+        histogram[bucket < histogram_buckets ? bucket : histogram_buckets - 1]++;
+        max_cycles = cycles > max_cycles ? cycles : max_cycles;
+        calls++;
+    }
+
+    void reset() {
+        for (auto& h : hits) h = 0;
+        for (auto& h : histogram) h = 0;
+        calls = max_cycles = 0;
+    }
+
+    void print() const {
+        static const char* names[] = { "normal early exit", "normal convex",
+                                       "normal tail",       "normal concave",
+                                       "normal inflection", "normal rejected",
+                                       "exp early exit",    "exp overhang",
+                                       "exp tail",          "exp rejected" };
+        printf("ziggurat stats: %lu calls, max %lu cycles\n",
+               (unsigned long)calls,
+               (unsigned long)max_cycles);
+        for (int i = 0; i < static_cast<int>(ziggurat_path::count); i++) {
+            printf("  %-18s %10lu\n", names[i], (unsigned long)hits[i]);
+        }
+        for (int k = 0; k < histogram_buckets; k++) {
+            if (!histogram[k]) continue;
+            printf("  %6lu+ cycles %10lu\n", k ? 1ul << k : 0ul, (unsigned long)histogram[k]);
+        }
+    }
+};
+} // namespace ziggurat
+} // namespace math
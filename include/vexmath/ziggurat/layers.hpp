@@ -0,0 +1,286 @@
+/* layers.hpp: compile-time construction of the ziggurat tables used by
+ * exponential.hpp and normal.hpp. Replaces the literal tables that used to be
+ * pasted from create_layers.py.
+ *
+ * Layers is the number of equal-area blocks the density is split into (must
+ * be a power of two). The first `bins` blocks are rectangles that can be
+ * sampled with a single multiplication (early exit), the remaining
+ * Layers - bins blocks worth of area (the overhangs and the tail) are sampled
+ * through the alias table. Fewer layers means smaller tables (less L1
+ * pressure) but a lower early exit rate.
+ * */
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace math {
+namespace ziggurat {
+namespace layers_detail {
+/* constexpr replacements for the libm functions, only accurate enough (and
+ * only valid in the ranges needed) to build the tables */
+constexpr double cexp(double x) {
+    constexpr double ln2 = 0.69314718055994530942;
+    if (x < -700) return 0;
+    int k = static_cast<int>(x / ln2 + (x < 0 ? -0.5 : 0.5));
+    double r = x - k * ln2; /* |r| <= ln2/2 */
+    double sum = 1;
+    for (int n = 13; n > 0; n--) sum = 1 + r * sum / n;
+    /* multiply by 2^k */
+    double base = k < 0 ? 0.5 : 2.0;
+    for (int e = k < 0 ? -k : k; e; e >>= 1, base *= base) {
+        if (e & 1) sum *= base;
+    }
+    return sum;
+}
+
+constexpr double cerfc(double x) { /* x >= 0 */
+    constexpr double inv_sqrt_pi = 0.56418958354775628695;
+    if (x < 2.5) { /* Taylor series of erf */
+        double term = x, sum = x;
+        for (int n = 1; n < 80; n++) {
+            term *= -x * x / n;
+            sum += term / (2 * n + 1);
+        }
+        return 1 - 2 * inv_sqrt_pi * sum;
+    }
+    /* Continued fraction: erfc(x) = exp(-x^2)/sqrt(pi) / (x + 1/2/(x + 1/(x + 3/2/(...)))) */
+    double k = 0;
+    for (int n = 120; n > 0; n--) k = (0.5 * n) / (x + k);
+    return cexp(-x * x) * inv_sqrt_pi / (x + k);
+}
+
+/* argmax of a unimodal function on [lo, hi] (golden-section search) */
+template<typename F>
+constexpr double argmax(F g, double lo, double hi, int iterations = 40) {
+    constexpr double r = 0.61803398874989484820;
+    double m1 = hi - r * (hi - lo), m2 = lo + r * (hi - lo);
+    double g1 = g(m1), g2 = g(m2);
+    for (int it = 0; it < iterations; it++) {
+        if (g1 < g2) {
+            lo = m1;
+            m1 = m2, g1 = g2;
+            m2 = lo + r * (hi - lo), g2 = g(m2);
+        } else {
+            hi = m2;
+            m2 = m1, g2 = g1;
+            m1 = hi - r * (hi - lo), g1 = g(m1);
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+/* root of g(x) = target on [lo, hi] where g is decreasing (bisection) */
+template<typename F>
+constexpr double solve_decreasing(F g, double target, double lo, double hi) {
+    for (int it = 0; it < 64; it++) {
+        double m = 0.5 * (lo + hi);
+        if (g(m) > target) lo = m;
+        else hi = m;
+    }
+    return 0.5 * (lo + hi);
+}
+
+/* 5-point Gauss-Legendre quadrature, the overhangs are narrow and smooth */
+template<typename F>
+constexpr double integrate(F f, double a, double b) {
+    constexpr double node[3] = { 0, 0.53846931010568309104, 0.90617984593866399280 };
+    constexpr double weight[3] = { 0.56888888888888888889,
+                                   0.47862867049936646804,
+                                   0.23692688505618908751 };
+    double c = 0.5 * (a + b), h = 0.5 * (b - a);
+    double sum = weight[0] * f(c);
+    for (int i = 1; i < 3; i++) {
+        sum += weight[i] * (f(c - h * node[i]) + f(c + h * node[i]));
+    }
+    return sum * h;
+}
+} // namespace layers_detail
+
+/* Unnormalized densities on [0, inf) along with the derivative of their
+ * logarithm, their total area, the area of their tail and their inflection
+ * point (0 if they are convex everywhere) */
+struct normal_density {
+    static constexpr double area = 1.2533141373155002512; /* sqrt(pi/2) */
+    static constexpr double inflection = 1;
+
+    static constexpr double f(double x) {
+        return layers_detail::cexp(-0.5 * x * x);
+    }
+
+    static constexpr double dlogf(double x) {
+        return -x;
+    }
+
+    static constexpr double tail(double x) {
+        return area * layers_detail::cerfc(x * 0.70710678118654752440);
+    }
+};
+
+struct exponential_density {
+    static constexpr double area = 1;
+    static constexpr double inflection = 0;
+
+    static constexpr double f(double x) {
+        return layers_detail::cexp(-x);
+    }
+
+    static constexpr double dlogf(double) {
+        return -1;
+    }
+
+    static constexpr double tail(double x) {
+        return layers_detail::cexp(-x);
+    }
+};
+
+/**
+ * @brief Ziggurat tables for Density split into Layers equal-area blocks.
+ *
+ * X and Y are scaled by 1/(2^31 - 1) so that X[i] * random_int31() is
+ * uniformly distributed on [0, x_i]. Layer i > 0 is the rectangle
+ * [0, X[i]] x [Y[i-1], Y[i]], overhang j is the area under the curve to the
+ * right of it, overhang 0 is the tail beyond X_0.
+ */
+template<typename Density, uint32_t Layers>
+struct ziggurat_layers {
+    static_assert(Layers >= 16 && Layers <= 4096 && (Layers & (Layers - 1)) == 0,
+                  "ziggurat layer count must be a power of two in [16, 4096]");
+
+    using map_type = std::conditional_t<(Layers <= 256), uint8_t, uint16_t>;
+
+    uint_fast16_t bins {};         /* rectangles sampled by early exit */
+    uint_fast16_t j_inflection {}; /* overhang containing the inflection point */
+    int32_t min_iE {};             /* early exit threshold of the overhangs below their chord */
+    int32_t max_iE {};             /* early exit threshold of the overhangs above their chord */
+    float X_0 {};                  /* start of the tail (not scaled) */
+    float X[Layers + 1] {};
+    float Y[Layers + 1] {};
+    int32_t ipmf[Layers] {};       /* alias table thresholds */
+    map_type map[Layers] {};       /* alias table */
+
+    constexpr ziggurat_layers() {
+        using namespace layers_detail;
+        constexpr double scale = 1.0 / 2147483647.0;
+        const double A = Density::area / Layers;
+        double x[Layers + 1] {}, y[Layers + 1] {};
+
+        /* X_0 is the larger root of x f(x) = A */
+        auto base = [](double t) { return t * Density::f(t); };
+        x[0] = solve_decreasing(base, A, argmax(base, 0, 64, 80), 64);
+        y[0] = Density::f(x[0]);
+
+        /* stack rectangles of area A until they no longer fit under the curve.
+         * Newton's method from the previous edge normally converges in a few
+         * steps; the robust (but slow) search is only needed for the last
+         * layers near the top. */
+        uint_fast16_t n = 0;
+        while (n + 1 < Layers) {
+            double y_n = y[n];
+            auto block = [y_n](double t) { return t * (Density::f(t) - y_n); };
+            double t = x[n];
+            bool converged = false;
+            for (int it = 0; it < 16; it++) {
+                double f_t = Density::f(t);
+                double slope = f_t - y_n + t * f_t * Density::dlogf(t);
+                if (slope >= 0) break;
+                double step = (t * (f_t - y_n) - A) / slope;
+                t -= step;
+                if (t <= 0 || t >= x[n]) break;
+                if (step < 1e-13 * t && step > -1e-13 * t) {
+                    converged = true;
+                    break;
+                }
+            }
+            if (!converged) {
+                double peak = argmax(block, 0, x[n], 80);
+                if (block(peak) < A) break;
+                t = solve_decreasing(block, A, peak, x[n]);
+            }
+            n++;
+            x[n] = t;
+            y[n] = Density::f(t);
+        }
+        bins = n + 1;
+        x[bins] = 0;
+        y[bins] = Density::f(0);
+
+        /* area of the tail and of every overhang, normalized so that each
+         * column of the alias table holds 1 */
+        double p[Layers] {}, total = 0;
+        p[0] = Density::tail(x[0]);
+        for (uint_fast16_t j = 1; j <= bins; j++) {
+            p[j] = integrate(Density::f, x[j], x[j - 1]) - (x[j - 1] - x[j]) * y[j - 1];
+        }
+        for (uint_fast16_t j = 0; j <= bins; j++) total += p[j];
+        for (uint_fast16_t j = 0; j <= bins; j++) p[j] *= Layers / total;
+
+        /* Vose's alias method */
+        uint_fast16_t small[Layers] {}, large[Layers] {};
+        uint_fast16_t n_small = 0, n_large = 0;
+        double q[Layers] {};
+        for (uint_fast16_t j = 0; j < Layers; j++) {
+            map[j] = static_cast<map_type>(j);
+            if (p[j] < 1) small[n_small++] = j;
+            else large[n_large++] = j;
+        }
+        while (n_small && n_large) {
+            uint_fast16_t s = small[--n_small], l = large[--n_large];
+            q[s] = p[s];
+            map[s] = static_cast<map_type>(l);
+            p[l] -= 1 - p[s];
+            if (p[l] < 1) small[n_small++] = l;
+            else large[n_large++] = l;
+        }
+        while (n_large) q[large[--n_large]] = 1;
+        while (n_small) { /* only left over due to rounding */
+            uint_fast16_t s = small[--n_small];
+            q[s] = s <= bins ? 1 : 0;
+        }
+        for (uint_fast16_t j = 0; j < Layers; j++) { /* keep j iff int32 U < ipmf[j] */
+            double threshold = q[j] * 4294967296.0 - 2147483648.0;
+            ipmf[j] = threshold >= 2147483647.0  ? INT32_MAX
+                      : threshold <= -2147483648.0 ? INT32_MIN
+                                                   : static_cast<int32_t>(threshold);
+        }
+
+        /* largest vertical distance between each overhang and its chord, in
+         * units of the overhang height */
+        double below = 0, above = 0;
+        for (uint_fast16_t j = 1; j <= bins; j++) {
+            double x_j = x[j], w = x[j - 1] - x[j], y_j = y[j - 1], h = y[j] - y[j - 1];
+            auto gap = [=](double u) {
+                return (1 - u) - (Density::f(x_j + w * u) - y_j) / h;
+            };
+            auto neg_gap = [=](double u) { return -gap(u); };
+            if (x[j] >= Density::inflection) {
+                double d = gap(argmax(gap, 0, 1, 30));
+                below = d > below ? d : below;
+            } else if (x[j - 1] <= Density::inflection) {
+                double d = neg_gap(argmax(neg_gap, 0, 1, 30));
+                above = d > above ? d : above;
+            } else {
+                j_inflection = j;
+            }
+        }
+        min_iE = static_cast<int32_t>(below * 2147483648.0) + 1;
+        max_iE = static_cast<int32_t>(above * 2147483648.0) + 1;
+
+        X_0 = static_cast<float>(x[0]);
+        for (uint_fast16_t i = 0; i <= bins; i++) {
+            X[i] = static_cast<float>(x[i] * scale);
+            Y[i] = static_cast<float>(y[i] * scale);
+        }
+    }
+};
+
+template<typename Density, uint32_t Layers>
+inline constexpr ziggurat_layers<Density, Layers> layers_of {};
+
+template<uint32_t Layers>
+inline constexpr const auto& normal_layers = layers_of<normal_density, Layers>;
+
+template<uint32_t Layers>
+inline constexpr const auto& exponential_layers = layers_of<exponential_density, Layers>;
+} // namespace ziggurat
+} // namespace math
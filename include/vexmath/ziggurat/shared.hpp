@@ -3,18 +3,12 @@
 #pragma once
 
 #include "vexmath/fast_prng/Xoroshiro128plus.hpp"
+#include "vexmath/ziggurat/instrument.hpp"
+#include "vexmath/ziggurat/tables.hpp"
 #include <math.h>
 #include <memory>
 #include <stdlib.h>
 
-/* Test to see if rejection sampling is required in the overhang. See Fig. 2
- * in main text. */
-
-#define _FAST_PRNG_SAMPLE_X(X_j, U)                    \
-    (*(X_j) * pow(2, 31) + ((X_j)[-1] - *(X_j)) * (U))
-#define _FAST_PRNG_SAMPLE_Y(i, U)                           \
-    (Y[(i) - 1] * pow(2, 31) + (Y[(i)] - Y[(i) - 1]) * (U))
-
 namespace math {
 namespace ziggurat {
 struct ziggurat_prng {
@@ -47,11 +41,29 @@ struct ziggurat_prng {
     }
 };
 
-class NormalPRNG {
+/**
+ * @brief Normal and exponential PRN generator.
+ *
+ * @tparam Layers number of ziggurat layers (power of two), see layers.hpp.
+ * More layers raise the early exit rate at the cost of bigger tables. Above
+ * 256 layers the layer index reuses bits that are not fully squashed by the
+ * float multiplication.
+ * @tparam Tables memory layout of the tables, see tables.hpp
+ * @tparam Stats no_stats, or ziggurat_stats to count the paths taken and
+ * time every call, see instrument.hpp
+ */
+template<uint32_t Layers = 256,
+         template<typename, uint32_t> class Tables = separate_tables,
+         typename Stats = no_stats>
+class ZigguratPRNG {
+    using norm_tables = Tables<normal_density, Layers>;
+    using exp_tables = Tables<exponential_density, Layers>;
+
   public:
     ziggurat_prng fast_prng;
+    [[no_unique_address]] Stats stats;
 
-    NormalPRNG(uint32_t seed)
+    ZigguratPRNG(uint32_t seed)
         : fast_prng(seed) {}
 
     void set_seed(uint32_t seed) {
@@ -68,7 +80,7 @@ class NormalPRNG {
     }
 
     // normal functions
-    uint_fast8_t _norm_sample_A(void);
+    uint_fast16_t _norm_sample_A(void);
     inline float normal(void);
 
     inline float normal(float mean, float std_deviation) {
@@ -76,9 +88,12 @@ class NormalPRNG {
     }
 
     // exponential functions
-    inline float _exp_overhang(uint_fast8_t j);
-    uint_fast8_t _exp_sample_A(void);
+    inline float _exp_overhang(uint_fast16_t j);
+    uint_fast16_t _exp_sample_A(void);
     inline float exponential(void);
 };
+
+using NormalPRNG = ZigguratPRNG<>;
+using InstrumentedNormalPRNG = ZigguratPRNG<256, separate_tables, ziggurat_stats>;
 } // namespace ziggurat
 } // namespace math
@@ -0,0 +1,113 @@
+/* tables.hpp: memory layouts of the ziggurat tables built in layers.hpp.
+ *
+ * separate_tables   -> one array per quantity (X, Y, ipmf, map). A draw that
+ *                      misses the early exit reads X[j], X[j-1], Y[j-1], Y[j],
+ *                      ipmf[j] and map[j], up to six cache lines.
+ * interleaved_tables -> everything the slow path needs about layer j is packed
+ *                      into one 32-byte record (one Cortex-A9 cache line), so a
+ *                      slow draw touches two lines: the alias column and the
+ *                      overhang. The early exit keeps reading a dense copy of
+ *                      X so the fast path is not spread over Layers lines.
+ *
+ * The remaining constants (bins, X_0, iE thresholds, j_inflection) are
+ * constexpr and end up as immediates, they never touch memory.
+ * */
+#pragma once
+
+#include "vexmath/ziggurat/layers.hpp"
+#include <math.h>
+
+/* Test to see if rejection sampling is required in the overhang. See Fig. 2
+ * in main text. */
+
+#define _FAST_PRNG_SAMPLE_X(X_j, U)                    \
+    (*(X_j) * pow(2, 31) + ((X_j)[-1] - *(X_j)) * (U))
+#define _FAST_PRNG_SAMPLE_Y(i, U)                           \
+    (Y[(i) - 1] * pow(2, 31) + (Y[(i)] - Y[(i) - 1]) * (U))
+
+namespace math {
+namespace ziggurat {
+template<typename Density, uint32_t Layers>
+struct separate_tables {
+    static constexpr const auto& layers = layers_of<Density, Layers>;
+
+    static float early(uint_fast16_t i) {
+        return layers.X[i];
+    }
+
+    static double sample_x(uint_fast16_t j, double U) {
+        const float* X_j = layers.X + j;
+        return _FAST_PRNG_SAMPLE_X(X_j, U);
+    }
+
+    static double sample_y(uint_fast16_t j, double U) {
+        const float* Y = layers.Y;
+        return _FAST_PRNG_SAMPLE_Y(j, U);
+    }
+
+    static uint_fast16_t alias(uint_fast16_t j, int32_t U) {
+        return U >= layers.ipmf[j] ? layers.map[j] : j;
+    }
+};
+
+/**
+ * @brief Everything the overhang path reads about layer j, padded to a
+ * Cortex-A9 cache line.
+ */
+struct alignas(32) ziggurat_record {
+    float X_prev; /* X[j - 1] */
+    float X;      /* X[j] */
+    float Y_prev; /* Y[j - 1] */
+    float Y;      /* Y[j] */
+    int32_t ipmf; /* alias threshold of column j */
+    uint32_t map; /* alias of column j */
+};
+
+template<typename Density, uint32_t Layers>
+struct interleaved_layers {
+    float X[Layers + 1] {}; /* dense copy for the early exit */
+    ziggurat_record record[Layers + 1] {};
+
+    constexpr interleaved_layers() {
+        const auto& layers = layers_of<Density, Layers>;
+        for (uint32_t j = 0; j <= Layers; j++) {
+            X[j] = layers.X[j];
+            record[j].X_prev = j ? layers.X[j - 1] : 0;
+            record[j].X = layers.X[j];
+            record[j].Y_prev = j ? layers.Y[j - 1] : 0;
+            record[j].Y = layers.Y[j];
+            record[j].ipmf = j < Layers ? layers.ipmf[j] : INT32_MIN;
+            record[j].map = j < Layers ? layers.map[j] : 0;
+        }
+    }
+};
+
+template<typename Density, uint32_t Layers>
+inline constexpr interleaved_layers<Density, Layers> interleaved_layers_of {};
+
+template<typename Density, uint32_t Layers>
+struct interleaved_tables {
+    static constexpr const auto& layers = layers_of<Density, Layers>;
+    static constexpr const auto& packed = interleaved_layers_of<Density, Layers>;
+
+    static float early(uint_fast16_t i) {
+        return packed.X[i];
+    }
+
+    static double sample_x(uint_fast16_t j, double U) {
+        const ziggurat_record& r = packed.record[j];
+        return r.X * pow(2, 31) + (r.X_prev - r.X) * U;
+    }
+
+    static double sample_y(uint_fast16_t j, double U) {
+        const ziggurat_record& r = packed.record[j];
+        return r.Y_prev * pow(2, 31) + (r.Y - r.Y_prev) * U;
+    }
+
+    static uint_fast16_t alias(uint_fast16_t j, int32_t U) {
+        const ziggurat_record& r = packed.record[j];
+        return U >= r.ipmf ? r.map : j;
+    }
+};
+} // namespace ziggurat
+} // namespace math
@@ -0,0 +1,695 @@
+#include "tests/distributions_test.hpp"
+#include "api.h"
+#include "vexmath/distributions/categorical.hpp"
+#include "vexmath/distributions/circular.hpp"
+#include "vexmath/distributions/gamma.hpp"
+#include "vexmath/distributions/heavy_tailed.hpp"
+#include "vexmath/distributions/multivariate_normal.hpp"
+#include "vexmath/distributions/truncated_normal.hpp"
+#include "vexmath/distributions/variance_reduction.hpp"
+#include "vexmath/distributions/poisson.hpp"
+#include <math.h>
+#include <random>
+#include <stdio.h>
+
+const int distributions_N = 20000;
+
+float distributions_output[distributions_N];
+
+int32_t distributions_counts[distributions_N];
+float distributions_sin[distributions_N];
+float distributions_cos[distributions_N];
+
+static math::distributions::GammaPRNG gamma_gen(2000);
+static math::distributions::PoissonPRNG poisson_gen(2000);
+static math::distributions::HeavyTailedPRNG heavy_gen(2000);
+static math::distributions::CircularPRNG circular_gen(2000);
+
+const float pose_covariance[3][3] = { { 0.04f, 0.01f, 0.002f },
+                                      { 0.01f, 0.09f, 0.003f },
+                                      { 0.002f, 0.003f, 0.01f } };
+static math::distributions::VMultivariateNormal<3> pose_gen(pose_covariance, 2000);
+static math::distributions::TruncatedNormalPRNG truncated_gen(2000);
+static math::distributions::CategoricalPRNG categorical_gen(2000);
+static math::distributions::AntitheticUniform antithetic_uniform_gen(2000);
+static math::distributions::AntitheticNormal<> antithetic_normal_gen(2000);
+static math::distributions::CommonStreams<> common_streams(2000);
+
+// checks the first two moments of the last generated batch
+bool check_moments(int n, double expected_mean, double expected_var) {
+    double mean = 0, var = 0;
+    for (int i = 0; i < n; i++) {
+        mean += distributions_output[i];
+        var += distributions_output[i] * distributions_output[i];
+    }
+    mean /= n;
+    var = var / n - mean * mean;
+    return fabs(mean - expected_mean) < 0.05 * (1 + expected_mean) &&
+           fabs(var - expected_var) < 0.1 * (1 + expected_var);
+}
+
+template<int Alpha10>
+int bench_std_gamma() {
+    static Xoroshiro128plus rng(2000);
+    std::gamma_distribution<float> dist(Alpha10 / 10.0f, 1);
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = dist(rng);
+    }
+    return 1;
+}
+
+template<int Alpha10>
+int bench_gamma() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = gamma_gen.gamma(Alpha10 / 10.0f);
+    }
+    return 1;
+}
+
+template<int Alpha10>
+int bench_fill_gamma() {
+    gamma_gen.fill_gamma(distributions_output, distributions_N, Alpha10 / 10.0f);
+    return 1;
+}
+
+template<int Alpha10>
+bool gamma_validator() {
+    return check_moments(distributions_N, Alpha10 / 10.0, Alpha10 / 10.0);
+}
+
+int bench_std_beta() {
+    static Xoroshiro128plus rng(2000);
+    std::gamma_distribution<float> dist_a(2, 1), dist_b(3, 1);
+    for (int i = 0; i < distributions_N; i++) {
+        float x = dist_a(rng);
+        distributions_output[i] = x / (x + dist_b(rng));
+    }
+    return 1;
+}
+
+int bench_beta() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = gamma_gen.beta(2, 3);
+    }
+    return 1;
+}
+
+int bench_fill_beta() {
+    gamma_gen.fill_beta(distributions_output, distributions_N, 2, 3);
+    return 1;
+}
+
+// beta(2, 3): mean 2/5, variance 6/(25*6)
+bool beta_validator() {
+    return check_moments(distributions_N, 0.4, 0.04);
+}
+
+// beta(0.01, 0.01), where both gammas often underflow to 0: mean 1/2,
+// variance 1/(4*1.02), and a NaN fails check_moments
+int bench_beta_small() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = gamma_gen.beta(0.01f, 0.01f);
+    }
+    return 1;
+}
+
+int bench_fill_beta_small() {
+    gamma_gen.fill_beta(distributions_output, distributions_N, 0.01f, 0.01f);
+    return 1;
+}
+
+bool beta_small_validator() {
+    return check_moments(distributions_N, 0.5, 0.245);
+}
+
+const int dirichlet_k = 5;
+const float dirichlet_alpha[dirichlet_k] = { 0.5f, 1, 2, 4, 8 };
+const float dirichlet_small_alpha[dirichlet_k] = { 0.01f, 0.01f, 0.01f, 0.01f, 0.02f };
+
+int bench_fill_dirichlet() {
+    gamma_gen.fill_dirichlet(distributions_output,
+                             distributions_N / dirichlet_k,
+                             dirichlet_alpha,
+                             dirichlet_k);
+    return 1;
+}
+
+int bench_fill_dirichlet_small() {
+    gamma_gen.fill_dirichlet(distributions_output,
+                             distributions_N / dirichlet_k,
+                             dirichlet_small_alpha,
+                             dirichlet_k);
+    return 1;
+}
+
+// every row must sum to 1 (no NaN) and component j must average
+// alpha_j / sum(alpha)
+bool check_dirichlet(const float* alpha, double tolerance) {
+    const int rows = distributions_N / dirichlet_k;
+    double mean[dirichlet_k] = {}, alpha_sum = 0;
+    for (int i = 0; i < rows; i++) {
+        double row = 0;
+        for (int j = 0; j < dirichlet_k; j++) {
+            float w = distributions_output[i * dirichlet_k + j];
+            if (!(w >= 0)) return false;
+            row += w;
+            mean[j] += w;
+        }
+        if (fabs(row - 1) > 1e-4) return false;
+    }
+    for (int j = 0; j < dirichlet_k; j++) alpha_sum += alpha[j];
+    for (int j = 0; j < dirichlet_k; j++) {
+        if (fabs(mean[j] / rows - alpha[j] / alpha_sum) > tolerance) return false;
+    }
+    return true;
+}
+
+bool dirichlet_validator() {
+    return check_dirichlet(dirichlet_alpha, 0.01);
+}
+
+// alpha <= 0.02: all 5 gammas underflow to 0 in about 1 row in 300 unless
+// the row is normalized in log space, most rows are a single weight close to
+// 1 and the means have a standard error of up to 0.007
+bool dirichlet_small_validator() {
+    return check_dirichlet(dirichlet_small_alpha, 0.03);
+}
+
+// same as check_moments for the count samplers
+bool check_count_moments(double expected_mean, double expected_var) {
+    double mean = 0, var = 0;
+    for (int i = 0; i < distributions_N; i++) {
+        if (distributions_counts[i] < 0) return false;
+        mean += distributions_counts[i];
+        var += (double)distributions_counts[i] * distributions_counts[i];
+    }
+    mean /= distributions_N;
+    var = var / distributions_N - mean * mean;
+    return fabs(mean - expected_mean) < 0.03 * (1 + expected_mean) &&
+           fabs(var - expected_var) < 0.1 * (1 + expected_var);
+}
+
+template<int Lambda>
+int bench_std_poisson() {
+    static Xoroshiro128plus rng(2000);
+    std::poisson_distribution<int32_t> dist(Lambda);
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_counts[i] = dist(rng);
+    }
+    return 1;
+}
+
+template<int Lambda>
+int bench_poisson() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_counts[i] = poisson_gen.poisson(Lambda);
+    }
+    return 1;
+}
+
+template<int Lambda>
+int bench_fill_poisson() {
+    poisson_gen.fill_poisson(distributions_counts, distributions_N, Lambda);
+    return 1;
+}
+
+template<int Lambda>
+bool poisson_validator() {
+    return check_count_moments(Lambda, Lambda);
+}
+
+// binomial benchmarks use p = Percent / 100
+template<int Trials, int Percent>
+int bench_std_binomial() {
+    static Xoroshiro128plus rng(2000);
+    std::binomial_distribution<int32_t> dist(Trials, Percent / 100.0);
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_counts[i] = dist(rng);
+    }
+    return 1;
+}
+
+template<int Trials, int Percent>
+int bench_binomial() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_counts[i] = poisson_gen.binomial(Trials, Percent / 100.0f);
+    }
+    return 1;
+}
+
+template<int Trials, int Percent>
+int bench_fill_binomial() {
+    poisson_gen.fill_binomial(distributions_counts, distributions_N, Trials, Percent / 100.0f);
+    return 1;
+}
+
+template<int Trials, int Percent>
+bool binomial_validator() {
+    const double p = Percent / 100.0;
+    return check_count_moments(Trials * p, Trials * p * (1 - p));
+}
+
+int bench_std_cauchy() {
+    static Xoroshiro128plus rng(2000);
+    std::cauchy_distribution<float> dist(0, 1);
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = dist(rng);
+    }
+    return 1;
+}
+
+int bench_fill_cauchy() {
+    heavy_gen.fill_cauchy(distributions_output, distributions_N);
+    return 1;
+}
+
+// the moments of the Cauchy distribution do not exist, check the quartiles
+bool cauchy_validator() {
+    int inside = 0, positive = 0;
+    for (int i = 0; i < distributions_N; i++) {
+        inside += fabs(distributions_output[i]) < 1;
+        positive += distributions_output[i] > 0;
+    }
+    return fabs(inside / (double)distributions_N - 0.5) < 0.02 &&
+           fabs(positive / (double)distributions_N - 0.5) < 0.02;
+}
+
+// std has no Laplace distribution, use an exponential with a random sign
+int bench_std_laplace() {
+    static Xoroshiro128plus rng(2000);
+    std::exponential_distribution<float> dist(1);
+    for (int i = 0; i < distributions_N; i++) {
+        float e = dist(rng);
+        distributions_output[i] = rng.next() & 1 ? e : -e;
+    }
+    return 1;
+}
+
+int bench_fill_laplace() {
+    heavy_gen.fill_laplace(distributions_output, distributions_N);
+    return 1;
+}
+
+bool laplace_validator() {
+    return check_moments(distributions_N, 0, 2);
+}
+
+int bench_std_student_t() {
+    static Xoroshiro128plus rng(2000);
+    std::student_t_distribution<float> dist(5);
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = dist(rng);
+    }
+    return 1;
+}
+
+int bench_fill_student_t() {
+    heavy_gen.fill_student_t(distributions_output, distributions_N, 5);
+    return 1;
+}
+
+// 5 degrees of freedom: variance 5/3
+bool student_t_validator() {
+    return check_moments(distributions_N, 0, 5 / 3.0);
+}
+
+const float heading_mean = 3.0f; // close to the wrap around on purpose
+
+// the usual way: scalar normal, fmod to wrap, then sin and cos
+int bench_std_wrapped_normal() {
+    static Xoroshiro128plus rng(2000);
+    std::normal_distribution<float> dist(heading_mean, 0.5f);
+    for (int i = 0; i < distributions_N; i++) {
+        float a = fmodf(dist(rng) + (float)M_PI, 2 * (float)M_PI);
+        a = (a < 0 ? a + 2 * (float)M_PI : a) - (float)M_PI;
+        distributions_output[i] = a;
+        distributions_sin[i] = sinf(a);
+        distributions_cos[i] = cosf(a);
+    }
+    return 1;
+}
+
+int bench_fill_wrapped_normal() {
+    circular_gen.fill_wrapped_normal(distributions_output,
+                                     distributions_N,
+                                     heading_mean,
+                                     0.5f,
+                                     distributions_sin,
+                                     distributions_cos);
+    return 1;
+}
+
+int bench_fill_von_mises() {
+    circular_gen.fill_von_mises(distributions_output,
+                                distributions_N,
+                                heading_mean,
+                                4,
+                                distributions_sin,
+                                distributions_cos);
+    return 1;
+}
+
+// angles must be in [-pi, pi), match their sin/cos and have the expected
+// mean resultant length E[cos(x - mean)]
+bool check_circular(double expected_length) {
+    double length = 0;
+    for (int i = 0; i < distributions_N; i++) {
+        float a = distributions_output[i];
+        if (a < -(float)M_PI || a >= (float)M_PI) return false;
+        if (fabs(distributions_sin[i] - sinf(a)) > 1e-4) return false;
+        if (fabs(distributions_cos[i] - cosf(a)) > 1e-4) return false;
+        length += cos(a - heading_mean);
+    }
+    return fabs(length / distributions_N - expected_length) < 0.01;
+}
+
+// exp(-sigma^2 / 2)
+bool wrapped_normal_validator() {
+    return check_circular(0.8824969);
+}
+
+// I1(4) / I0(4)
+bool von_mises_validator() {
+    return check_circular(0.8635226);
+}
+
+// pose noise is written to distributions_output (x), distributions_sin (y) and
+// distributions_cos (theta)
+int bench_scalar_pose() {
+    static Xoroshiro128plus rng(2000);
+    std::normal_distribution<float> dist(0, 1);
+    const auto& L = pose_gen.cholesky();
+    for (int i = 0; i < distributions_N; i++) {
+        float z[3] = { dist(rng), dist(rng), dist(rng) };
+        float* out[3] = { distributions_output + i, distributions_sin + i, distributions_cos + i };
+        for (int r = 0; r < 3; r++) {
+            float sum = 0;
+            for (int c = 0; c < 3; c++) sum += L[r][c] * z[c];
+            *out[r] = sum;
+        }
+    }
+    return 1;
+}
+
+int bench_fill_pose() {
+    pose_gen.fill({ distributions_output, distributions_sin, distributions_cos }, distributions_N);
+    return 1;
+}
+
+// sample covariance must match pose_covariance
+bool pose_validator() {
+    /* a zero pivot with a nonzero remainder is indefinite, not singular */
+    const float indefinite[2][2] = { { 0, 1 }, { 1, 1 } };
+    const float singular[2][2] = { { 0, 0 }, { 0, 1 } };
+    static math::distributions::VMultivariateNormal<2> check(singular, 1);
+    if (check.set_covariance(indefinite) || !check.set_covariance(singular)) return false;
+    const float* c[3] = { distributions_output, distributions_sin, distributions_cos };
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j <= i; j++) {
+            double sum = 0;
+            for (int k = 0; k < distributions_N; k++) sum += c[i][k] * c[j][k];
+            double expected = pose_covariance[i][j];
+            double scale = sqrt(pose_covariance[i][i] * pose_covariance[j][j]);
+            if (fabs(sum / distributions_N - expected) > 0.05 * scale) return false;
+        }
+    }
+    return true;
+}
+
+// truncated normal benchmarks use the bounds [Lo10 / 10, Hi10 / 10] (Hi10 = 0
+// means no upper bound) on a standard normal
+template<int Lo10, int Hi10>
+int bench_reject_truncated() {
+    static math::ziggurat::NormalPRNG gen(2000);
+    const float lo = Lo10 / 10.0f, hi = Hi10 ? Hi10 / 10.0f : INFINITY;
+    for (int i = 0; i < distributions_N; i++) {
+        float x;
+        do x = gen.normal();
+        while (x < lo || x > hi);
+        distributions_output[i] = x;
+    }
+    return 1;
+}
+
+template<int Lo10, int Hi10>
+int bench_fill_truncated() {
+    const float lo = Lo10 / 10.0f, hi = Hi10 ? Hi10 / 10.0f : INFINITY;
+    truncated_gen.fill_truncated_normal(distributions_output, distributions_N, 0, 1, lo, hi);
+    return 1;
+}
+
+// [2.5, inf): mean phi(a) / (1 - Phi(a))
+bool truncated_tail_validator() {
+    for (int i = 0; i < distributions_N; i++) {
+        if (distributions_output[i] < 2.5f) return false;
+    }
+    return check_moments(distributions_N, 2.8227448, 0.0889738);
+}
+
+bool truncated_center_validator() {
+    for (int i = 0; i < distributions_N; i++) {
+        if (fabs(distributions_output[i]) > 1) return false;
+    }
+    return check_moments(distributions_N, 0, 0.2911251);
+}
+
+// categorical benchmarks draw from weights 1..categorical_k, given as
+// unnormalized log-weights
+const int categorical_k = 16;
+const int top_k = 4;
+float categorical_log_weights[categorical_k];
+
+void init_categorical_weights() {
+    for (int i = 0; i < categorical_k; i++) categorical_log_weights[i] = logf(i + 1) - 50;
+}
+
+// the usual way: exp every weight, then search the cumulative sum
+int bench_exp_categorical() {
+    static Xoroshiro128plus rng(2000);
+    std::uniform_real_distribution<float> dist(0, 1);
+    for (int i = 0; i < distributions_N; i++) {
+        float w[categorical_k], total = 0;
+        for (int j = 0; j < categorical_k; j++) total += w[j] = expf(categorical_log_weights[j]);
+        float u = dist(rng) * total;
+        int j = 0;
+        while (j < categorical_k - 1 && (u -= w[j]) >= 0) j++;
+        distributions_counts[i] = j;
+    }
+    return 1;
+}
+
+int bench_gumbel_categorical() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_counts[i] = categorical_gen.sample(categorical_log_weights, categorical_k);
+    }
+    return 1;
+}
+
+// top_k draws per row, distributions_N / top_k rows
+int bench_gumbel_top_k() {
+    size_t draws[top_k];
+    for (int i = 0; i < distributions_N / top_k; i++) {
+        categorical_gen.sample_top_k(categorical_log_weights, categorical_k, draws, top_k);
+        for (int j = 0; j < top_k; j++) distributions_counts[i * top_k + j] = draws[j];
+    }
+    return 1;
+}
+
+// chi-square of counts[0], counts[stride], ... against weights 1..categorical_k,
+// 15 degrees of freedom
+bool check_categorical(int n, int stride) {
+    int observed[categorical_k] = {};
+    for (int i = 0; i < n; i++) {
+        int32_t c = distributions_counts[i * stride];
+        if (c < 0 || c >= categorical_k) return false;
+        observed[c]++;
+    }
+    double chi2 = 0;
+    for (int j = 0; j < categorical_k; j++) {
+        double expected = n * (j + 1) / (categorical_k * (categorical_k + 1) / 2.0);
+        chi2 += (observed[j] - expected) * (observed[j] - expected) / expected;
+    }
+    return chi2 < 40;
+}
+
+bool categorical_validator() {
+    return check_categorical(distributions_N, 1);
+}
+
+// rows must hold distinct indices, and the first draw of each row is a
+// categorical draw
+bool top_k_validator() {
+    const int rows = distributions_N / top_k;
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < top_k; j++) {
+            for (int l = 0; l < j; l++) {
+                if (distributions_counts[i * top_k + j] == distributions_counts[i * top_k + l]) return false;
+            }
+        }
+    }
+    return check_categorical(rows, top_k);
+}
+
+int bench_fill_antithetic_uniform() {
+    antithetic_uniform_gen.fill(distributions_output, distributions_N);
+    return 1;
+}
+
+// uniform on (0, 1), and every block of 8 holds 4 pairs summing to 1
+bool antithetic_uniform_validator() {
+    for (int i = 0; i + 8 <= distributions_N; i += 8) {
+        for (int j = 0; j < 4; j++) {
+            float u = distributions_output[i + j];
+            if (u <= 0 || u >= 1 || u + distributions_output[i + j + 4] != 1) return false;
+        }
+    }
+    return check_moments(distributions_N, 0.5, 1 / 12.0);
+}
+
+int bench_antithetic_normal() {
+    for (int i = 0; i < distributions_N; i++) {
+        distributions_output[i] = antithetic_normal_gen.normal();
+    }
+    return 1;
+}
+
+// pairs cancel exactly, so the sample mean is 0 up to rounding
+bool antithetic_normal_validator() {
+    double mean = 0;
+    for (int i = 0; i < distributions_N; i += 2) {
+        if (distributions_output[i] != -distributions_output[i + 1]) return false;
+        mean += distributions_output[i] + distributions_output[i + 1];
+    }
+    return mean == 0 && check_moments(distributions_N, 0, 1);
+}
+
+// two "controllers" each draw common_draws normals from every scenario, the
+// first one into distributions_output and the second one into
+// distributions_sin
+const int common_draws = 50;
+
+int bench_common_streams() {
+    for (int s = 0; s < distributions_N / common_draws; s++) {
+        auto first = common_streams.normal_stream(s);
+        for (int i = 0; i < common_draws; i++) {
+            distributions_output[s * common_draws + i] = first.normal();
+        }
+        auto second = common_streams.normal_stream(s);
+        for (int i = 0; i < common_draws; i++) {
+            distributions_sin[s * common_draws + i] = second.normal();
+        }
+    }
+    return 1;
+}
+
+// both controllers saw the same noise, and consecutive scenarios differ
+bool common_streams_validator() {
+    for (int i = 0; i < distributions_N; i++) {
+        if (distributions_output[i] != distributions_sin[i]) return false;
+    }
+    for (int s = 1; s < distributions_N / common_draws; s++) {
+        if (distributions_output[s * common_draws] == distributions_output[(s - 1) * common_draws]) {
+            return false;
+        }
+    }
+    return check_moments(distributions_N, 0, 1);
+}
+
+void run_distribution_bench(const char* s, int (*fn)(), bool (*validator)(), int n) {
+    printf("benching %40s ..", s);
+    fflush(stdout);
+    int32_t it0 = pros::micros(), it1;
+    double iter = 0;
+    // avoid variations due time of pros::micros
+    for (long long i = 0; i < 200; i++) {
+        iter += fn();
+        i++;
+    }
+    it1 = pros::micros();
+    double micro_t0 = (double)it0, micro_t1 = (double)it1;
+
+    double d_microsec = ((micro_t1 - micro_t0) / ((double)iter));
+    double d_millisec = d_microsec / 1000.0;
+    double numbers_microsec = n / d_microsec;
+
+    // verify output is valid
+    bool valid = validator();
+    if (!valid) {
+        printf(" -> failed validity tests!");
+    }
+
+    printf(" -> %d elements in %3.2f milliseconds -> %3.2f numbers/microsecond\n",
+           n,
+           d_millisec,
+           numbers_microsec);
+}
+
+void distributions_test() {
+    printf("---------------------\n");
+    printf("running distribution benchmarks\n");
+    const int N = distributions_N;
+
+    run_distribution_bench("std::gamma_distribution (alpha 0.5)", bench_std_gamma<5>, gamma_validator<5>, N);
+    run_distribution_bench("gamma (alpha 0.5)", bench_gamma<5>, gamma_validator<5>, N);
+    run_distribution_bench("fill_gamma (alpha 0.5)", bench_fill_gamma<5>, gamma_validator<5>, N);
+    run_distribution_bench("std::gamma_distribution (alpha 2)", bench_std_gamma<20>, gamma_validator<20>, N);
+    run_distribution_bench("gamma (alpha 2)", bench_gamma<20>, gamma_validator<20>, N);
+    run_distribution_bench("fill_gamma (alpha 2)", bench_fill_gamma<20>, gamma_validator<20>, N);
+    run_distribution_bench("std::gamma_distribution (alpha 10)", bench_std_gamma<100>, gamma_validator<100>, N);
+    run_distribution_bench("gamma (alpha 10)", bench_gamma<100>, gamma_validator<100>, N);
+    run_distribution_bench("fill_gamma (alpha 10)", bench_fill_gamma<100>, gamma_validator<100>, N);
+
+    run_distribution_bench("std::gamma_distribution beta (2, 3)", bench_std_beta, beta_validator, N);
+    run_distribution_bench("beta (2, 3)", bench_beta, beta_validator, N);
+    run_distribution_bench("fill_beta (2, 3)", bench_fill_beta, beta_validator, N);
+    run_distribution_bench("beta (0.01, 0.01)", bench_beta_small, beta_small_validator, N);
+    run_distribution_bench("fill_beta (0.01, 0.01)", bench_fill_beta_small, beta_small_validator, N);
+    run_distribution_bench("fill_dirichlet (k = 5)", bench_fill_dirichlet, dirichlet_validator, N);
+    run_distribution_bench("fill_dirichlet (k = 5, alpha <= 0.02)",
+                           bench_fill_dirichlet_small,
+                           dirichlet_small_validator,
+                           N);
+
+    run_distribution_bench("std::poisson_distribution (lambda 3)", bench_std_poisson<3>, poisson_validator<3>, N);
+    run_distribution_bench("poisson (lambda 3)", bench_poisson<3>, poisson_validator<3>, N);
+    run_distribution_bench("fill_poisson (lambda 3)", bench_fill_poisson<3>, poisson_validator<3>, N);
+    run_distribution_bench("std::poisson_distribution (lambda 50)", bench_std_poisson<50>, poisson_validator<50>, N);
+    run_distribution_bench("poisson (lambda 50)", bench_poisson<50>, poisson_validator<50>, N);
+    run_distribution_bench("fill_poisson (lambda 50)", bench_fill_poisson<50>, poisson_validator<50>, N);
+
+    run_distribution_bench("std::binomial_distribution (20, 0.1)", bench_std_binomial<20, 10>, binomial_validator<20, 10>, N);
+    run_distribution_bench("binomial (20, 0.1)", bench_binomial<20, 10>, binomial_validator<20, 10>, N);
+    run_distribution_bench("fill_binomial (20, 0.1)", bench_fill_binomial<20, 10>, binomial_validator<20, 10>, N);
+    run_distribution_bench("std::binomial_distribution (1000, 0.7)", bench_std_binomial<1000, 70>, binomial_validator<1000, 70>, N);
+    run_distribution_bench("binomial (1000, 0.7)", bench_binomial<1000, 70>, binomial_validator<1000, 70>, N);
+    run_distribution_bench("fill_binomial (1000, 0.7)", bench_fill_binomial<1000, 70>, binomial_validator<1000, 70>, N);
+
+    run_distribution_bench("std::cauchy_distribution", bench_std_cauchy, cauchy_validator, N);
+    run_distribution_bench("fill_cauchy", bench_fill_cauchy, cauchy_validator, N);
+    run_distribution_bench("std::exponential_distribution laplace", bench_std_laplace, laplace_validator, N);
+    run_distribution_bench("fill_laplace", bench_fill_laplace, laplace_validator, N);
+    run_distribution_bench("std::student_t_distribution (nu 5)", bench_std_student_t, student_t_validator, N);
+    run_distribution_bench("fill_student_t (nu 5)", bench_fill_student_t, student_t_validator, N);
+
+    run_distribution_bench("std::normal_distribution + fmod + sincos", bench_std_wrapped_normal, wrapped_normal_validator, N);
+    run_distribution_bench("fill_wrapped_normal + sincos", bench_fill_wrapped_normal, wrapped_normal_validator, N);
+    run_distribution_bench("fill_von_mises + sincos (kappa 4)", bench_fill_von_mises, von_mises_validator, N);
+
+    run_distribution_bench("std::normal_distribution 3x3 pose", bench_scalar_pose, pose_validator, N);
+    run_distribution_bench("VMultivariateNormal<3> fill", bench_fill_pose, pose_validator, N);
+
+    run_distribution_bench("normal rejection [-1, 1]", bench_reject_truncated<-10, 10>, truncated_center_validator, N);
+    run_distribution_bench("fill_truncated_normal [-1, 1]", bench_fill_truncated<-10, 10>, truncated_center_validator, N);
+    run_distribution_bench("normal rejection [2.5, inf)", bench_reject_truncated<25, 0>, truncated_tail_validator, N);
+    run_distribution_bench("fill_truncated_normal [2.5, inf)", bench_fill_truncated<25, 0>, truncated_tail_validator, N);
+
+    init_categorical_weights();
+    run_distribution_bench("expf + cdf search (k = 16)", bench_exp_categorical, categorical_validator, N);
+    run_distribution_bench("gumbel-max categorical (k = 16)", bench_gumbel_categorical, categorical_validator, N);
+    run_distribution_bench("gumbel top 4 of 16", bench_gumbel_top_k, top_k_validator, N);
+
+    run_distribution_bench("AntitheticUniform fill", bench_fill_antithetic_uniform, antithetic_uniform_validator, N);
+    run_distribution_bench("AntitheticNormal normal", bench_antithetic_normal, antithetic_normal_validator, N);
+    run_distribution_bench("CommonStreams (50 normals per scenario)", bench_common_streams, common_streams_validator, N);
+    printf("---------------------\n");
+}
@@ -8,9 +8,11 @@
 
 #include <arm_neon.h>
 
+#include "tests/distributions_test.hpp"
 #include "tests/neon_mathfun_test.hpp"
 #include "tests/taylor_test.hpp"
 #include "tests/xoroshiro128_test.hpp"
+#include "tests/ziggurat_test.hpp"
 
 using namespace std;
 
@@ -30,6 +32,8 @@ void autonomous() {}
 void general_tests() {
     xoroshiro128_test();
     taylor_test();
+    ziggurat_test();
+    distributions_test();
     // neon_mathfun_test();
     return;
 
@@ -130,7 +130,11 @@ void print4i(uint32x4_t v) {
   printf("[%08x %08x %08x %08x]", p[0], p[1], p[2], p[3]);
 }
 
+#include "vexmath/functions/vectorized_activation.hpp"
+#include "vexmath/functions/vectorized_angle.hpp"
 #include "vexmath/functions/vectorized_exp_log.hpp"
+#include "vexmath/functions/vectorized_normal.hpp"
+#include "vexmath/functions/vectorized_sqrt.hpp"
 #include "vexmath/functions/vectorized_trig.hpp"
 #include "vexmath/functions/vectorized_trig_taylor.hpp"
 #include "vexmath/functions/trig_taylor.hpp"
@@ -277,6 +281,165 @@ int check_sincos_precision(float xmin, float xmax) {
   }
 }
 
+int check_sincos_tiers(float xmin, float xmax) {
+  unsigned nb_trials = 100000;
+  printf("checking sincos_ps<Degree> on [%g*Pi, %g*Pi]\n", xmin, xmax);
+
+  float max_err[3] = { 0 }, max_err_x[3] = { 0 };
+  const int degree[3] = { 3, 5, 7 };
+  const float bound[3] = { 2.5e-3f, 1.1e-5f, 2e-7f };
+  xmin *= M_PI; xmax *= M_PI;
+  unsigned i, k;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, s[3], c[3];
+    vx.f[0] = i*(xmax-xmin)/(nb_trials-1) + xmin;
+    vx.f[1] = frand()*(xmax-xmin) + xmin;
+    vx.f[2] = frand()*(xmax-xmin) + xmin;
+    vx.f[3] = (frand()-.5f)*M_PI;
+    sincos_ps<3>(vx.v, &s[0].v, &c[0].v);
+    sincos_ps<5>(vx.v, &s[1].v, &c[1].v);
+    sincos_ps<7>(vx.v, &s[2].v, &c[2].v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      double x = vx.f[j];
+      for (k=0; k < 3; ++k) {
+        float err = MAX(fabs(s[k].f[j] - sin(x)), fabs(c[k].f[j] - cos(x)));
+        if (err > max_err[k]) { max_err[k] = err; max_err_x[k] = x; }
+      }
+    }
+  }
+  /* the full tier is sincos_ps itself */
+  V4SF vx = {{ -3, 0.1f, 1000, 7 }}, s7, c7, s, c;
+  sincos_ps<7>(vx.v, &s7.v, &c7.v);
+  sincos_ps(vx.v, &s.v, &c.v);
+  int ok = 1;
+  for (i=0; i < 4; ++i) ok = ok && s7.f[i] == s.f[i] && c7.f[i] == c.f[i];
+
+  printf("max (absolute) deviation from sin / cos:\n");
+  for (k=0; k < 3; ++k) {
+    printf("  sincos_ps<%d>  %11g at %14.12g*Pi\n", degree[k], max_err[k], max_err_x[k]/M_PI);
+    ok = ok && max_err[k] < bound[k];
+  }
+  if (ok) {
+    printf("   ->> precision OK for the sincos_ps<Degree> <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+int check_tan_precision(float xmin, float xmax) {
+  unsigned nb_trials = 100000;
+  printf("checking tan on [%g*Pi, %g*Pi]\n", xmin, xmax);
+
+  float max_err_tan_ref = 0, max_err_tan_x = 0;
+  float max_err_pole = 0, max_err_pole_x = 0;
+  xmin *= M_PI; xmax *= M_PI;
+  unsigned i;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, tan4, sin4, cos4;
+    vx.f[0] = i*(xmax-xmin)/(nb_trials-1) + xmin;
+    vx.f[1] = frand()*(xmax-xmin) + xmin;
+    /* next to the poles k Pi + Pi/2 */
+    float k = floorf(frand()*(xmax-xmin)/M_PI + xmin/M_PI);
+    vx.f[2] = (k + .5f)*M_PI + (frand()-.5f)*1e-3f;
+    vx.f[3] = nextafterf((float)((k + .5)*M_PI), (i&1) ? INFINITY : -INFINITY);
+    tan4.v = tan_ps(vx.v);
+    sincos_ps(vx.v, &sin4.v, &cos4.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      float x = vx.f[j];
+      /* relative to tan(x) computed in double from the float sin / cos of
+         x, so that it only measures the quotient and not the reduction */
+      double tan_ref = (double)sin4.f[j] / cos4.f[j];
+      float err = fabs(tan4.f[j] - tan_ref) / MAX(fabs(tan_ref), 1.);
+      if (j < 2) {
+        if (err > max_err_tan_ref) {
+          max_err_tan_ref = err;
+          max_err_tan_x = x;
+        }
+      } else if (err > max_err_pole) {
+        max_err_pole = err;
+        max_err_pole_x = x;
+      }
+      /* same sign as tanf, especially near the poles */
+      if (x < 8192 && x > -8192 && (tan4.f[j] < 0) != (tanf(x) < 0) && fabs(tanf(x)) > 1e-6) {
+        printf("tan / tanf sign mismatch at x=%g\n", x);
+        return 1;
+      }
+    }
+  }
+  printf("max (relative) deviation from sin/cos: %g at %14.12g*Pi\n", max_err_tan_ref, max_err_tan_x/M_PI);
+  printf("max (relative) deviation near the poles: %g at %14.12g*Pi\n", max_err_pole, max_err_pole_x/M_PI);
+
+  if (max_err_tan_ref < 5e-7 && max_err_pole < 5e-7) {
+    printf("   ->> precision OK for the tan_ps <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+int check_atan_precision(float xmin, float xmax) {
+  unsigned nb_trials = 100000;
+  printf("checking atan / atan2 on [%g, %g]\n", xmin, xmax);
+
+  float max_err_atan_ref = 0, max_err_atan_x = 0;
+  float max_err_atan2_ref = 0, max_err_atan2_y = 0, max_err_atan2_x = 0;
+  float max_err_tan = 0;
+  unsigned i;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, vy, atan4, atan2_4;
+    vx.f[0] = i*(xmax-xmin)/(nb_trials-1) + xmin;
+    vx.f[1] = frand()*(xmax-xmin) + xmin;
+    /* around the reduction thresholds tan(Pi/8) and tan(3Pi/8) */
+    vx.f[2] = (i&1 ? 0.41421356f : 2.4142136f) * (1 + (frand()-.5f)*1e-4f);
+    vx.f[3] = tanf((frand()-.5f)*M_PI);
+    /* atan2 gets every quadrant, and the axes every 64 trials */
+    vy.f[0] = frand()*(xmax-xmin) + xmin;
+    vy.f[1] = frand()*(xmax-xmin) + xmin;
+    vy.f[2] = -vx.f[2];
+    vy.f[3] = (i & 63) == 0 ? 0 : frand()*2 - 1;
+    if ((i & 63) == 1) vx.f[1] = 0;
+    atan4.v = atan_ps(vx.v);
+    atan2_4.v = atan2_ps(vy.v, vx.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      float x = vx.f[j], y = vy.f[j];
+      float err_atan_ref = fabs(atanf(x) - atan4.f[j]);
+      if (err_atan_ref > max_err_atan_ref) {
+        max_err_atan_ref = err_atan_ref;
+        max_err_atan_x = x;
+      }
+      float err_atan2_ref = fabs(atan2f(y, x) - atan2_4.f[j]);
+      if (err_atan2_ref > max_err_atan2_ref) {
+        max_err_atan2_ref = err_atan2_ref;
+        max_err_atan2_y = y;
+        max_err_atan2_x = x;
+      }
+      /* tan(atan(x)) - x, relative to x */
+      if (fabs(x) > 1e-3 && fabs(x) < 1e3) {
+        float err_tan = fabs(tan((double)atan4.f[j]) - x) / fabs(x) / (1 + x*x);
+        max_err_tan = MAX(max_err_tan, err_tan);
+      }
+    }
+  }
+  printf("max deviation from atanf(x): %g at x=%14.12g\n", max_err_atan_ref, max_err_atan_x);
+  printf("max deviation from atan2f(y, x): %g at y=%14.12g, x=%14.12g\n",
+         max_err_atan2_ref, max_err_atan2_y, max_err_atan2_x);
+  printf("deviation of tan(atan(x)) - x: %g\n", max_err_tan);
+
+  if (max_err_atan_ref < 2.5e-7 && max_err_atan2_ref < 5e-7 && max_err_tan < 5e-7) {
+    printf("   ->> precision OK for the atan_ps / atan2_ps <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
 union float_int_union {
   int i;
   float f;
@@ -337,8 +500,537 @@ int check_explog_precision(float xmin, float xmax) {
   printf("deviation of x - log(exp(x)): %g (ref deviation is %g)\n",
          max_err_logexp_test, max_err_logexp_ref); 
 
-  if (max_err_logexp_test < 2e-7 && max_err_exp_ref < 2e-7 && max_err_log_ref < 2e-7) {
-    printf("   ->> precision OK for the exp_ps / log_ps <<-\n\n");
+  /* base 2 / 10 versions on the same range (scaled to base 2 for exp2),
+     errors relative to max(|result|, 1) for the logs */
+  float max_err_exp2 = 0, max_err_exp2_x = 0;
+  float max_err_log2 = 0, max_err_log2_x = 0;
+  float max_err_log10 = 0, max_err_log10_x = 0;
+  float max_err_pow = 0, max_err_pow_x = 0, max_err_pow_y = 0;
+  int exact_ok = 1;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, vy, exp2_4, log2_4, log10_4, pow4;
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      vx.f[j] = (frand()*(xmax-xmin)+xmin) * (float)M_LOG2E;
+      vy.f[j] = frand()*8 - 4;
+    }
+    exp2_4.v = exp2_ps(vx.v);
+    log2_4.v = log2_ps(exp2_4.v);
+    log10_4.v = log10_ps(exp2_4.v);
+    /* non-uniform exponents, so that the exp2 / log2 path is measured */
+    pow4.v = pow_ps(exp2_4.v, vy.v);
+    for (j=0; j < 4; ++j) {
+      float x = vx.f[j], e = exp2_4.f[j];
+      double exp2_ref = exp2((double)x);
+      float err_exp2 = fabs(e - exp2_ref) / exp2_ref;
+      if (err_exp2 > max_err_exp2) { max_err_exp2 = err_exp2; max_err_exp2_x = x; }
+      double log2_ref = log2((double)e);
+      float err_log2 = fabs(log2_4.f[j] - log2_ref) / MAX(fabs(log2_ref), 1.);
+      if (err_log2 > max_err_log2) { max_err_log2 = err_log2; max_err_log2_x = e; }
+      double log10_ref = log10((double)e);
+      float err_log10 = fabs(log10_4.f[j] - log10_ref) / MAX(fabs(log10_ref), 1.);
+      if (err_log10 > max_err_log10) { max_err_log10 = err_log10; max_err_log10_x = e; }
+      /* relative, per unit of the exponent y log2(x) */
+      double pow_ref = pow((double)e, (double)vy.f[j]);
+      if (pow_ref > 1e-37 && pow_ref < 1e37) {
+        float err_pow = fabs(pow4.f[j] - pow_ref) / pow_ref / MAX(fabs(vy.f[j]*log2_ref), 1.);
+        if (err_pow > max_err_pow) { max_err_pow = err_pow; max_err_pow_x = e; max_err_pow_y = vy.f[j]; }
+      }
+    }
+  }
+  /* exact cases: integer powers of two, squares and signs of pow */
+  for (i=0; i < 126; ++i) {
+    V4SF vk = {{ (float)i, -(float)i, (float)i - 63, 0.5f }}, p2, l2;
+    p2.v = exp2_ps(vk.v);
+    l2.v = log2_ps(p2.v);
+    for (unsigned j=0; j < 3; ++j) {
+      exact_ok = exact_ok && p2.f[j] == ldexpf(1, (int)vk.f[j]) && l2.f[j] == vk.f[j];
+    }
+  }
+  V4SF vb = {{ -3, 1.5f, -0.f, 7 }}, vp, sq, cube, half, zero_exp;
+  sq.v = pow_ps(vb.v, vdupq_n_f32(2));
+  vp.f[0] = 3; vp.f[1] = 3; vp.f[2] = 3; vp.f[3] = 0.5f;
+  cube.v = pow_ps(vb.v, vp.v);
+  vp.f[0] = 0.5f; vp.f[1] = 0.5f; vp.f[2] = -1; vp.f[3] = 0;
+  half.v = pow_ps(vb.v, vp.v);
+  zero_exp.v = pow_ps(vdupq_n_f32(0), vp.v);
+  for (i=0; i < 4; ++i) exact_ok = exact_ok && sq.f[i] == vb.f[i]*vb.f[i];
+  exact_ok = exact_ok && fabs(cube.f[0] + 27) < 1e-5f && fabs(cube.f[1] - 3.375f) < 1e-6f && cube.f[2] == 0 && signbit(cube.f[2]);
+  exact_ok = exact_ok && isnan(half.f[0]) && half.f[2] == -INFINITY && half.f[3] == 1;
+  exact_ok = exact_ok && zero_exp.f[0] == 0 && zero_exp.f[2] == INFINITY && zero_exp.f[3] == 1;
+  /* parity of large exponents: odd integers exist up to 2^24 */
+  V4SF vm1 = {{ -1, -1, -1, -1 }}, vbig = {{ 8388609, 16777215, 16777216, 33554432 }}, sbig;
+  sbig.v = pow_ps(vm1.v, vbig.v);
+  exact_ok = exact_ok && sbig.f[0] == -1 && sbig.f[1] == -1 && sbig.f[2] == 1 && sbig.f[3] == 1;
+
+  printf("max (relative) deviation from exp2(x): %g at %14.12g\n", max_err_exp2, max_err_exp2_x);
+  printf("max deviation from log2(x): %g at %14.12g\n", max_err_log2, max_err_log2_x);
+  printf("max deviation from log10(x): %g at %14.12g\n", max_err_log10, max_err_log10_x);
+  printf("max (relative) deviation from pow(x, y) per unit of y*log2(x): %g at x=%14.12g, y=%g\n",
+         max_err_pow, max_err_pow_x, max_err_pow_y);
+  printf("exp2 / log2 of integers, pow special cases: %s\n", exact_ok ? "exact" : "WRONG");
+
+  if (max_err_logexp_test < 2e-7 && max_err_exp_ref < 2e-7 && max_err_log_ref < 2e-7
+      && max_err_exp2 < 2e-7 && max_err_log2 < 2e-7 && max_err_log10 < 2e-7
+      && max_err_pow < 2e-7 && exact_ok) {
+    printf("   ->> precision OK for the exp_ps / log_ps / exp2_ps / log2_ps / log10_ps / pow_ps <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+
+
+/* reference quantile in double: Acklam's approximation polished by one
+   Halley step on erfc, good to ~1e-15 */
+double ref_normal_icdf(double p) {
+  static const double a[6] = { -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                               1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00 };
+  static const double b[5] = { -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                               6.680131188771972e+01, -1.328068155288572e+01 };
+  static const double c[6] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                               -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00 };
+  static const double d[4] = { 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                               3.754408661907416e+00 };
+  double x;
+  if (p < 0.02425 || p > 1 - 0.02425) {
+    double q = sqrt(-2*log(p < 0.5 ? p : 1 - p));
+    x = (((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) / ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1);
+    if (p > 0.5) x = -x;
+  } else {
+    double q = p - 0.5, r = q*q;
+    x = (((((a[0]*r+a[1])*r+a[2])*r+a[3])*r+a[4])*r+a[5])*q / (((((b[0]*r+b[1])*r+b[2])*r+b[3])*r+b[4])*r+1);
+  }
+  double e = 0.5 * erfc(-x/sqrt(2.)) - p;
+  double u = e * sqrt(2*M_PI) * exp(x*x/2);
+  return x - u/(1 + x*u/2);
+}
+
+/* distance in float ulps between a and b */
+float ulpdiff(float a, double b) {
+  return fabs(a - b) / (nextafterf(fabsf((float)b), INFINITY) - fabsf((float)b));
+}
+
+/* sincos_ps_bounded on [-Pi, Pi] and sincos_ps_pio4 on [-Pi/4, Pi/4], for
+   each tier, against sin / cos and against sincos_ps at the range ends */
+int check_sincos_bounded() {
+  unsigned nb_trials = 100000;
+  printf("checking sincos_ps_bounded on [-Pi, Pi] and sincos_ps_pio4 on [-Pi/4, Pi/4]\n");
+
+  float max_err[2][3] = {{ 0 }}, max_err_x[2][3] = {{ 0 }};
+  const int degree[3] = { 3, 5, 7 };
+  const float bound[3] = { 2.5e-3f, 1.1e-5f, 2e-7f };
+  const float range[2] = { (float)M_PI, (float)M_PI_4 };
+  unsigned i, k, v;
+  for (i=0; i < nb_trials; ++i) {
+    for (v=0; v < 2; ++v) {
+      V4SF vx, s[3], c[3];
+      vx.f[0] = (2.f*i/(nb_trials-1) - 1)*range[v];
+      vx.f[1] = (2*frand() - 1)*range[v];
+      vx.f[2] = (2*frand() - 1)*range[v];
+      vx.f[3] = (2*frand() - 1)*1e-3f;
+      if (v == 0) {
+        sincos_ps_bounded<3>(vx.v, &s[0].v, &c[0].v);
+        sincos_ps_bounded<5>(vx.v, &s[1].v, &c[1].v);
+        sincos_ps_bounded<7>(vx.v, &s[2].v, &c[2].v);
+      } else {
+        sincos_ps_pio4<3>(vx.v, &s[0].v, &c[0].v);
+        sincos_ps_pio4<5>(vx.v, &s[1].v, &c[1].v);
+        sincos_ps_pio4<7>(vx.v, &s[2].v, &c[2].v);
+      }
+      unsigned j;
+      for (j=0; j < 4; ++j) {
+        double x = vx.f[j];
+        for (k=0; k < 3; ++k) {
+          float err = MAX(fabs(s[k].f[j] - sin(x)), fabs(c[k].f[j] - cos(x)));
+          if (err > max_err[v][k]) { max_err[v][k] = err; max_err_x[v][k] = x; }
+        }
+      }
+    }
+  }
+
+  /* the full tier agrees with sincos_ps to an ulp where the reduction
+     matters most: sin((float)M_PI) = -8.74e-8, not 0 */
+  const float edge[8] = { (float)M_PI, -(float)M_PI, (float)M_PI_2, -(float)M_PI_2,
+                          (float)M_PI_4, 3*(float)M_PI_4, 0, -0.f };
+  float max_ulp = 0;
+  for (i=0; i < 8; i += 4) {
+    V4SF vx, s, c, s_ref, c_ref;
+    for (k=0; k < 4; ++k) vx.f[k] = edge[i + k];
+    sincos_ps_bounded(vx.v, &s.v, &c.v);
+    sincos_ps(vx.v, &s_ref.v, &c_ref.v);
+    for (k=0; k < 4; ++k) {
+      max_ulp = MAX(max_ulp, ulpdiff(s.f[k], sin((double)vx.f[k])));
+      max_ulp = MAX(max_ulp, ulpdiff(c.f[k], cos((double)vx.f[k])));
+      max_ulp = MAX(max_ulp, ulpdiff(s.f[k], s_ref.f[k]));
+    }
+  }
+
+  int ok = max_ulp <= 2;
+  printf("max (absolute) deviation from sin / cos:\n");
+  for (k=0; k < 3; ++k) {
+    printf("  sincos_ps_bounded<%d>  %11g at %14.12g*Pi\n", degree[k], max_err[0][k], max_err_x[0][k]/M_PI);
+    printf("  sincos_ps_pio4<%d>     %11g at %14.12g*Pi\n", degree[k], max_err[1][k], max_err_x[1][k]/M_PI);
+    ok = ok && max_err[0][k] < bound[k] && max_err[1][k] < bound[k];
+  }
+  printf("max deviation at the range ends: %g ulp\n", max_ulp);
+  if (ok) {
+    printf("   ->> precision OK for the sincos_ps_bounded / sincos_ps_pio4 <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+/* distance between two angles modulo period */
+double angle_dist(double a, double b, double period) {
+  double d = fmod(fabs(a - b), period);
+  return fmin(d, period - d);
+}
+
+int check_angle_precision() {
+  unsigned nb_trials = 100000;
+  printf("checking wrap_pi_ps, wrap_2pi_ps, angle_diff_ps and the degree versions\n");
+
+  /* 0: wrap_pi, 1: wrap_2pi, 2: angle_diff, 3: wrap_180, 4: wrap_360,
+     5: angle_diff_deg */
+  const char *name[6] = { "wrap_pi_ps", "wrap_2pi_ps", "angle_diff_ps",
+                          "wrap_180_ps", "wrap_360_ps", "angle_diff_deg_ps" };
+  const double lo[6] = { -M_PI, 0, -M_PI, -180, 0, -180 };
+  const double period[6] = { 2*M_PI, 2*M_PI, 2*M_PI, 360, 360, 360 };
+  const float bound[6] = { 2e-6f, 2e-6f, 2e-6f, 0, 4e-5f, 0 };
+  float max_err[6] = { 0 }, max_err_x[6] = { 0 };
+  int out_of_range = 0;
+  unsigned i, k;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, vy, r[6];
+    vx.f[0] = (2.f*i/(nb_trials-1) - 1)*1e4f;
+    vx.f[1] = (2*frand() - 1)*1e5f;
+    vx.f[2] = (2*frand() - 1)*10;
+    /* right next to the range ends */
+    vx.f[3] = (frand()-.5f)*1e-3f + (i % 4)*(float)M_PI - 2*(float)M_PI;
+    for (k=0; k < 4; ++k) vy.f[k] = (2*frand() - 1)*100;
+    r[0].v = wrap_pi_ps(vx.v);
+    r[1].v = wrap_2pi_ps(vx.v);
+    r[2].v = angle_diff_ps(vx.v, vy.v);
+    /* 57 degrees per radian covers the same number of turns */
+    V4SF vd; vd.v = vmulq_n_f32(vx.v, 57);
+    if (i % 2) vd.f[3] = (frand()-.5f)*1e-3f + (i % 8)*180 - 720;
+    r[3].v = wrap_180_ps(vd.v);
+    r[4].v = wrap_360_ps(vd.v);
+    r[5].v = angle_diff_deg_ps(vd.v, vy.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      for (k=0; k < 6; ++k) {
+        double x = k < 3 ? vx.f[j] : vd.f[j];
+        /* the differences are taken in float, their rounding is not the
+           wrapping's */
+        double ref = k % 3 == 2 ? (float)(x - vy.f[j]) : x;
+        float err = angle_dist(r[k].f[j], ref, period[k]);
+        if (!(r[k].f[j] >= lo[k] && r[k].f[j] < lo[k] + period[k]) &&
+            !(k < 3 && fabs(r[k].f[j]) == (float)M_PI && r[k].f[j] < lo[k] + period[k])) {
+          if (!out_of_range) printf("  %s(%.9g) = %.9g out of range\n", name[k], x, r[k].f[j]);
+          out_of_range++;
+        }
+        if (err > max_err[k]) { max_err[k] = err; max_err_x[k] = x; }
+      }
+    }
+  }
+
+  /* the array versions, in place, with a tail */
+  float a[7], b[7], d[7];
+  for (i=0; i < 7; ++i) { a[i] = i*10.f - 30; b[i] = 7.f - i; }
+  angle_diff_array(d, a, b, 7);
+  wrap_pi_array(a, a, 7);
+  int ok = 1;
+  for (i=0; i < 7; ++i) {
+    ok = ok && angle_dist(a[i], i*10. - 30, 2*M_PI) < 1e-6 && a[i] >= -M_PI && a[i] < M_PI;
+    ok = ok && angle_dist(d[i], (i*10. - 30) - (7. - i), 2*M_PI) < 1e-5;
+  }
+
+  printf("max (absolute) deviation, modulo the period:\n");
+  for (k=0; k < 6; ++k) {
+    printf("  %-18s %11g at %14.9g\n", name[k], max_err[k], max_err_x[k]);
+    ok = ok && max_err[k] <= bound[k];
+  }
+  ok = ok && out_of_range == 0;
+  if (ok) {
+    printf("   ->> precision OK for the angle wrapping <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+int check_normal_icdf_precision() {
+  unsigned nb_trials = 100000;
+  printf("checking normal_icdf on (0, 1)\n");
+
+  float max_err_abs = 0, max_err_abs_x = 0;
+  float max_err_ulp = 0, max_err_ulp_x = 0;
+  float max_err_tail = 0, max_err_tail_x = 0;
+  float max_err_cdf = 0;
+  unsigned i;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vp, x4;
+    /* uniform on (0, 1), plus both tails down to 1e-37 on a log scale */
+    vp.f[0] = (i + .5) / nb_trials;
+    vp.f[1] = frand()*(1 - 1e-7) + 5e-8;
+    vp.f[2] = pow(10., -37*frand());
+    vp.f[3] = 1 - pow(10., -7*frand());
+    x4.v = normal_icdf_ps(vp.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      float p = vp.f[j];
+      float x_test = x4.f[j];
+      if (p <= 0 || p >= 1) continue;
+      double x_ref = ref_normal_icdf(p);
+      float err_abs = fabs(x_test - x_ref);
+      float err_ulp = ulpdiff(x_test, x_ref);
+      if (j < 2) {
+        if (err_abs > max_err_abs) {
+          max_err_abs = err_abs;
+          max_err_abs_x = p;
+        }
+        if (err_ulp > max_err_ulp) {
+          max_err_ulp = err_ulp;
+          max_err_ulp_x = p;
+        }
+      } else {
+        /* relative to the result, the absolute error grows with |x| */
+        float err_tail = err_abs / fabs(x_ref);
+        if (err_tail > max_err_tail) {
+          max_err_tail = err_tail;
+          max_err_tail_x = p;
+        }
+      }
+      /* round trip through the CDF, relative to min(p, 1 - p) */
+      double cdf = 0.5 * erfc(-x_test/sqrt(2.));
+      double tail = p < 0.5 ? p : 1 - (double)p;
+      float err_cdf = fabs(cdf - p) / tail;
+      max_err_cdf = MAX(max_err_cdf, err_cdf);
+    }
+  }
+  printf("max (absolute) deviation on (0, 1): %g at p=%14.12g\n", max_err_abs, max_err_abs_x);
+  printf("max deviation on (0, 1): %g ulp at p=%14.12g\n", max_err_ulp, max_err_ulp_x);
+  printf("max (relative) deviation in the tails: %g at p=%14.12g\n", max_err_tail, max_err_tail_x);
+  printf("max (relative) deviation of cdf(icdf(p)) - p: %g\n", max_err_cdf);
+
+  if (max_err_abs < 2e-6 && max_err_ulp < 16 && max_err_tail < 1e-6 && max_err_cdf < 1e-4) {
+    printf("   ->> precision OK for the normal_icdf_ps <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+
+int check_asin_precision() {
+  unsigned nb_trials = 100000;
+  printf("checking asin / acos on [-1, 1]\n");
+
+  /* max deviations by range of |x|, the reduction changes at 0.5 */
+  const float bounds[] = { 0, 0.5f, 0.9f, 0.999f, 1 };
+  const int nb_ranges = 4;
+  float max_err_asin[4] = { 0 }, max_err_acos[4] = { 0 };
+  float max_ulp_asin[4] = { 0 }, max_ulp_acos[4] = { 0 };
+  float max_err_clamp = 0;
+  unsigned i;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, asin4, acos4;
+    vx.f[0] = i*2.f/(nb_trials-1) - 1;
+    vx.f[1] = frand()*2 - 1;
+    vx.f[2] = (1 - pow(10., -7*frand())) * (i&1 ? 1 : -1);
+    vx.f[3] = (0.5f + (frand()-.5f)*1e-3f) * (i&1 ? 1 : -1);
+    asin4.v = asin_ps(vx.v);
+    acos4.v = acos_ps(vx.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      float x = vx.f[j];
+      int k = 0;
+      while (k < nb_ranges - 1 && fabs(x) > bounds[k+1]) ++k;
+      double asin_ref = asin((double)x), acos_ref = acos((double)x);
+      max_err_asin[k] = MAX(max_err_asin[k], fabs(asin4.f[j] - asin_ref));
+      max_err_acos[k] = MAX(max_err_acos[k], fabs(acos4.f[j] - acos_ref));
+      if (x != 0) max_ulp_asin[k] = MAX(max_ulp_asin[k], ulpdiff(asin4.f[j], asin_ref));
+      if (x != 1) max_ulp_acos[k] = MAX(max_ulp_acos[k], ulpdiff(acos4.f[j], acos_ref));
+    }
+  }
+  /* out of the domain the input is clamped */
+  V4SF vx = {{ -1.0001f, 1.0001f, -2, 1e30f }}, asin4, acos4;
+  asin4.v = asin_ps(vx.v);
+  acos4.v = acos_ps(vx.v);
+  for (i=0; i < 4; ++i) {
+    float c = vx.f[i] < 0 ? -1 : 1;
+    max_err_clamp = MAX(max_err_clamp, fabs(asin4.f[i] - asinf(c)));
+    max_err_clamp = MAX(max_err_clamp, fabs(acos4.f[i] - acosf(c)));
+  }
+
+  printf("        |x| in       asin abs     asin ulp     acos abs     acos ulp\n");
+  int ok = max_err_clamp == 0;
+  for (i=0; i < (unsigned)nb_ranges; ++i) {
+    printf("  [%5g, %5g]  %11g  %11g  %11g  %11g\n", bounds[i], bounds[i+1],
+           max_err_asin[i], max_ulp_asin[i], max_err_acos[i], max_ulp_acos[i]);
+    ok = ok && max_err_asin[i] < 2.5e-7 && max_err_acos[i] < 5e-7
+            && max_ulp_asin[i] < 6 && max_ulp_acos[i] < 6;
+  }
+  printf("max deviation outside of [-1, 1] (clamped): %g\n", max_err_clamp);
+
+  if (ok) {
+    printf("   ->> precision OK for the asin_ps / acos_ps <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+/* max relative error of the 4 outputs of fn against ref(x) */
+#define SQRT_MAX_ERR(fn, ref, err) do {                         \
+    V4SF y; y.v = fn;                                           \
+    for (j=0; j < 4; ++j) {                                     \
+      double r = ref;                                           \
+      err = MAX(err, (float)(fabs(y.f[j] - r) / fabs(r)));      \
+    }                                                           \
+  } while (0)
+
+int check_sqrt_precision() {
+  unsigned nb_trials = 100000;
+  printf("checking rsqrt / sqrt / recip / div tiers on [1e-37, 1e37]\n");
+
+  float err_rsqrt[3] = { 0 }, err_sqrt[3] = { 0 }, err_recip[3] = { 0 }, err_div[3] = { 0 };
+  float err_quake = 0;
+  unsigned i, j;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, va;
+    for (j=0; j < 4; ++j) {
+      vx.f[j] = pow(10., 74*frand() - 37);
+      va.f[j] = (frand() - .5f) * 1e3f;
+    }
+#define X ((double)vx.f[j])
+#define A ((double)va.f[j])
+    SQRT_MAX_ERR(Vrsqrt<0>(vx.v), 1/sqrt(X), err_rsqrt[0]);
+    SQRT_MAX_ERR(Vrsqrt<1>(vx.v), 1/sqrt(X), err_rsqrt[1]);
+    SQRT_MAX_ERR(Vrsqrt<2>(vx.v), 1/sqrt(X), err_rsqrt[2]);
+    SQRT_MAX_ERR(Vsqrt<0>(vx.v), sqrt(X), err_sqrt[0]);
+    SQRT_MAX_ERR(Vsqrt<1>(vx.v), sqrt(X), err_sqrt[1]);
+    SQRT_MAX_ERR(Vsqrt<2>(vx.v), sqrt(X), err_sqrt[2]);
+    SQRT_MAX_ERR(Vrecip<0>(vx.v), 1/X, err_recip[0]);
+    SQRT_MAX_ERR(Vrecip<1>(vx.v), 1/X, err_recip[1]);
+    SQRT_MAX_ERR(Vrecip<2>(vx.v), 1/X, err_recip[2]);
+    /* keeps a / x a normal float */
+    for (j=0; j < 4; ++j) vx.f[j] = pow(10., 6*frand() - 3);
+    SQRT_MAX_ERR(Vdiv<0>(va.v, vx.v), A/X, err_div[0]);
+    SQRT_MAX_ERR(Vdiv<1>(va.v, vx.v), A/X, err_div[1]);
+    SQRT_MAX_ERR(Vdiv<2>(va.v, vx.v), A/X, err_div[2]);
+    SQRT_MAX_ERR(V_rsqrt(vx.v), 1/sqrt(X), err_quake);
+#undef X
+#undef A
+  }
+
+  /* zero and infinity are exact in every tier */
+  V4SF vs = {{ 0, INFINITY, 0, INFINITY }}, r0, r1, r2, s0, s1, s2, q0, q1, q2;
+  r0.v = Vrsqrt<0>(vs.v); r1.v = Vrsqrt<1>(vs.v); r2.v = Vrsqrt<2>(vs.v);
+  s0.v = Vsqrt<0>(vs.v); s1.v = Vsqrt<1>(vs.v); s2.v = Vsqrt<2>(vs.v);
+  q0.v = Vrecip<0>(vs.v); q1.v = Vrecip<1>(vs.v); q2.v = Vrecip<2>(vs.v);
+  int special_ok = 1;
+  for (j=0; j < 4; ++j) {
+    float inv = vs.f[j] == 0 ? INFINITY : 0;
+    special_ok = special_ok && r0.f[j] == inv && r1.f[j] == inv && r2.f[j] == inv;
+    special_ok = special_ok && s0.f[j] == vs.f[j] && s1.f[j] == vs.f[j] && s2.f[j] == vs.f[j];
+    special_ok = special_ok && q0.f[j] == inv && q1.f[j] == inv && q2.f[j] == inv;
+  }
+
+  printf("max (relative) deviation   Steps=0      Steps=1      Steps=2\n");
+  printf("  rsqrt                %11g  %11g  %11g\n", err_rsqrt[0], err_rsqrt[1], err_rsqrt[2]);
+  printf("  sqrt                 %11g  %11g  %11g\n", err_sqrt[0], err_sqrt[1], err_sqrt[2]);
+  printf("  recip                %11g  %11g  %11g\n", err_recip[0], err_recip[1], err_recip[2]);
+  printf("  div                  %11g  %11g  %11g\n", err_div[0], err_div[1], err_div[2]);
+  printf("  V_rsqrt (Quake)      %11g\n", err_quake);
+  printf("zero / inf: %s\n", special_ok ? "exact" : "WRONG");
+
+  const float bound[3] = { 4e-3f, 5e-5f, 4e-7f };
+  int ok = special_ok;
+  for (i=0; i < 3; ++i) {
+    ok = ok && err_rsqrt[i] < bound[i] && err_sqrt[i] < bound[i]
+            && err_recip[i] < bound[i] && err_div[i] < bound[i];
+  }
+  if (ok) {
+    printf("   ->> precision OK for the Vrsqrt / Vsqrt / Vrecip / Vdiv <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
+
+int check_activation_precision(float xmin, float xmax) {
+  unsigned nb_trials = 100000;
+  printf("checking tanh / sigmoid / softplus on [%g, %g]\n", xmin, xmax);
+
+  float max_err_tanh = 0, max_err_tanh_x = 0;
+  float max_err_sigmoid = 0, max_err_sigmoid_x = 0;
+  float max_err_softplus = 0, max_err_softplus_x = 0;
+  float max_err_tanh_fast = 0, max_err_sigmoid_fast = 0;
+  unsigned i;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, tanh4, sigmoid4, softplus4, tanh_fast4, sigmoid_fast4;
+    vx.f[0] = i*(xmax-xmin)/(nb_trials-1) + xmin;
+    vx.f[1] = frand()*(xmax-xmin) + xmin;
+    /* around the switch of tanh_ps at 0.625, and close to 0 */
+    vx.f[2] = (0.625f + (frand()-.5f)*1e-2f) * (i&1 ? 1 : -1);
+    vx.f[3] = (frand()-.5f)*1e-3f;
+    tanh4.v = tanh_ps(vx.v);
+    sigmoid4.v = sigmoid_ps(vx.v);
+    softplus4.v = softplus_ps(vx.v);
+    tanh_fast4.v = tanh_fast_ps(vx.v);
+    sigmoid_fast4.v = sigmoid_fast_ps(vx.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      double x = vx.f[j];
+      /* relative errors, except for the fast versions */
+      double tanh_ref = tanh(x), sigmoid_ref = 1/(1 + exp(-x)), softplus_ref = log1p(exp(x));
+      float err_tanh = tanh_ref == 0 ? 0 : fabs(tanh4.f[j] - tanh_ref) / fabs(tanh_ref);
+      if (err_tanh > max_err_tanh) { max_err_tanh = err_tanh; max_err_tanh_x = x; }
+      if (x > -80) {
+        float err_sigmoid = fabs(sigmoid4.f[j] - sigmoid_ref) / sigmoid_ref;
+        if (err_sigmoid > max_err_sigmoid) { max_err_sigmoid = err_sigmoid; max_err_sigmoid_x = x; }
+        float err_softplus = fabs(softplus4.f[j] - softplus_ref) / softplus_ref;
+        if (err_softplus > max_err_softplus) { max_err_softplus = err_softplus; max_err_softplus_x = x; }
+      }
+      max_err_tanh_fast = MAX(max_err_tanh_fast, fabs(tanh_fast4.f[j] - tanh_ref));
+      max_err_sigmoid_fast = MAX(max_err_sigmoid_fast, fabs(sigmoid_fast4.f[j] - sigmoid_ref));
+    }
+  }
+
+  /* saturation, and the array versions (odd length, in place) */
+  V4SF vs = {{ INFINITY, -INFINITY, 1e30f, -1e30f }}, t, s, sp;
+  t.v = tanh_ps(vs.v); s.v = sigmoid_ps(vs.v); sp.v = softplus_ps(vs.v);
+  int special_ok = t.f[0] == 1 && t.f[1] == -1 && t.f[2] == 1 && t.f[3] == -1
+    && s.f[0] == 1 && s.f[1] == 0 && s.f[2] == 1 && s.f[3] == 0
+    && sp.f[0] == INFINITY && sp.f[1] == 0 && sp.f[2] == 1e30f && sp.f[3] == 0;
+  float a[11], b[11];
+  for (i=0; i < 11; ++i) a[i] = b[i] = (i - 5.f) * 0.7f;
+  tanh_array(a, a, 11);
+  for (i=0; i < 11; ++i) {
+    V4SF v; v.v = tanh_ps(vdupq_n_f32(b[i]));
+    special_ok = special_ok && a[i] == v.f[0];
+  }
+
+  printf("max (relative) deviation from tanh(x): %g at %14.12g\n", max_err_tanh, max_err_tanh_x);
+  printf("max (relative) deviation from 1/(1+exp(-x)): %g at %14.12g\n", max_err_sigmoid, max_err_sigmoid_x);
+  printf("max (relative) deviation from log1p(exp(x)): %g at %14.12g\n", max_err_softplus, max_err_softplus_x);
+  printf("max (absolute) deviation of tanh_fast / sigmoid_fast: %g / %g\n", max_err_tanh_fast, max_err_sigmoid_fast);
+  printf("saturation and arrays: %s\n", special_ok ? "OK" : "WRONG");
+
+  if (max_err_tanh < 3e-7 && max_err_sigmoid < 3e-7 && max_err_softplus < 5e-7
+      && max_err_tanh_fast < 5e-5 && max_err_sigmoid_fast < 5e-5 && special_ok) {
+    printf("   ->> precision OK for the tanh_ps / sigmoid_ps / softplus_ps <<-\n\n");
     return 0;
   } else {
     printf("\n   WRONG PRECISION !! there is a problem\n\n");
@@ -346,7 +1038,66 @@ int check_explog_precision(float xmin, float xmax) {
   }
 }
 
+int check_normal_precision() {
+  unsigned nb_trials = 100000;
+  printf("checking erf / erfc / normal cdf / pdf / logpdf on [-15, 15]\n");
 
+  /* relative errors, skipping results that are about to underflow */
+  const char *names[5] = { "erf(x)", "erfc(x)", "normal cdf(x)", "normal pdf(x)", "normal logpdf(x)" };
+  const float bound[5] = { 3e-7f, 1.5e-6f, 1.5e-6f, 5e-7f, 3e-7f };
+  float max_err[5] = { 0 }, max_err_x[5] = { 0 };
+  unsigned i, k;
+  for (i=0; i < nb_trials; ++i) {
+    V4SF vx, vmu, vinv, r[5];
+    vx.f[0] = i*30.f/(nb_trials-1) - 15;
+    vx.f[1] = frand()*30 - 15;
+    vx.f[2] = frand()*4 - 2;
+    vx.f[3] = (frand() - .5f)*1e-3f;
+    for (k=0; k < 4; ++k) {
+      vmu.f[k] = frand()*2 - 1;
+      vinv.f[k] = 0.5f + frand()*4;
+    }
+    r[0].v = erf_ps(vx.v);
+    r[1].v = erfc_ps(vx.v);
+    r[2].v = normal_cdf_ps(vx.v);
+    r[3].v = normal_pdf_ps(vx.v, vmu.v, vinv.v);
+    r[4].v = normal_logpdf_ps(vx.v, vmu.v, vinv.v);
+    unsigned j;
+    for (j=0; j < 4; ++j) {
+      /* z rounded as in the functions, the density can't be more precise
+         than its argument (z^2 / 2 amplifies its rounding) */
+      double x = vx.f[j], z = (float)(vx.f[j] - vmu.f[j]) * vinv.f[j];
+      double ref[5] = { erf(x), erfc(x), 0.5*erfc(-x/sqrt(2.)),
+                        vinv.f[j] * exp(-z*z/2) / sqrt(2*M_PI),
+                        -z*z/2 + log((double)vinv.f[j]) - 0.5*log(2*M_PI) };
+      for (k=0; k < 5; ++k) {
+        if (fabs(ref[k]) < 1e-36) continue;
+        float err = fabs(r[k].f[j] - ref[k]) / fabs(ref[k]);
+        /* the log-density crosses 0 */
+        if (k == 4) err = fabs(r[k].f[j] - ref[k]) / MAX(fabs(ref[k]), 1.);
+        if (err > max_err[k]) { max_err[k] = err; max_err_x[k] = x; }
+      }
+    }
+  }
+  /* the scalar inv_sigma overload is the same function */
+  V4SF vx = {{ -3, -0.5f, 0.25f, 4 }}, l1, l2;
+  l1.v = normal_logpdf_ps(vx.v, vdupq_n_f32(0.5f), vdupq_n_f32(2));
+  l2.v = normal_logpdf_ps(vx.v, vdupq_n_f32(0.5f), 2.f);
+  int ok = 1;
+  for (i=0; i < 4; ++i) ok = ok && fabs(l1.f[i] - l2.f[i]) <= 1e-6f * MAX(fabs(l1.f[i]), 1.f);
+
+  for (k=0; k < 5; ++k) {
+    printf("max (relative) deviation from %s: %g at %14.12g\n", names[k], max_err[k], max_err_x[k]);
+    ok = ok && max_err[k] < bound[k];
+  }
+  if (ok) {
+    printf("   ->> precision OK for the erf_ps / erfc_ps / normal_cdf_ps / normal_pdf_ps / normal_logpdf_ps <<-\n\n");
+    return 0;
+  } else {
+    printf("\n   WRONG PRECISION !! there is a problem\n\n");
+    return 1;
+  }
+}
 
 void dumb() {
   V4SF x = {{ 0.0903333798051, 0.0903333798051, 0.0903333798051, 0.0903333798051 }};
@@ -450,6 +1201,137 @@ v4sf stupid_sincos_ps(v4sf x) {
   return s + c;
 }
 
+v4sf stupid_sincos3_ps(v4sf x) {
+  v4sf s, c;
+  sincos_ps<3>(x, &s, &c);
+  return s + c;
+}
+
+v4sf stupid_sincos5_ps(v4sf x) {
+  v4sf s, c;
+  sincos_ps<5>(x, &s, &c);
+  return s + c;
+}
+
+v4sf stupid_sincos_bounded_ps(v4sf x) {
+  v4sf s, c;
+  sincos_ps_bounded(x, &s, &c);
+  return s + c;
+}
+
+v4sf stupid_sincos_bounded5_ps(v4sf x) {
+  v4sf s, c;
+  sincos_ps_bounded<5>(x, &s, &c);
+  return s + c;
+}
+
+/* the bench keeps x in [0.5, 1], scaled into [-Pi/4, Pi/4] here */
+v4sf stupid_sincos_pio4_ps(v4sf x) {
+  v4sf s, c;
+  sincos_ps_pio4(vmulq_n_f32(x, 0.75f), &s, &c);
+  return s + c;
+}
+
+/* the tangent as the quotient of sin_ps / cos_ps, for comparison */
+v4sf stupid_tan_ps(v4sf x) {
+  v4sf s, c;
+  sincos_ps(x, &s, &c);
+  return Vdiv<2>(s, c);
+}
+
+/* atan2 of points spread over the 4 quadrants as x goes from 0.5 to 1 */
+v4sf stupid_atan2_ps(v4sf x) {
+  return atan2_ps(vsubq_f32(vdupq_n_f32(0.75f), x), vsubq_f32(x, vdupq_n_f32(0.8f)));
+}
+
+/* maps x in [0.5, 1] onto [-1, 1] so that both branches are exercised */
+v4sf stupid_asin_ps(v4sf x) {
+  return asin_ps(vmlaq_n_f32(vdupq_n_f32(-3), x, 4));
+}
+
+v4sf stupid_acos_ps(v4sf x) {
+  return acos_ps(vmlaq_n_f32(vdupq_n_f32(-3), x, 4));
+}
+
+/* same x * 40 as the scalar wrapping benches */
+v4sf stupid_wrap_pi_ps(v4sf x) {
+  return wrap_pi_ps(vmulq_n_f32(x, 40));
+}
+
+v4sf stupid_wrap_2pi_ps(v4sf x) {
+  return wrap_2pi_ps(vmulq_n_f32(x, 40));
+}
+
+v4sf stupid_angle_diff_ps(v4sf x) {
+  return angle_diff_ps(vmulq_n_f32(x, 40), vdupq_n_f32(0.3f));
+}
+
+v4sf stupid_wrap_180_ps(v4sf x) {
+  return wrap_180_ps(vmulq_n_f32(x, 2000));
+}
+
+float stupid_asinf(float x) {
+  return asinf(fmodf(x, 2) - 1);
+}
+
+float stupid_acosf(float x) {
+  return acosf(fmodf(x, 2) - 1);
+}
+
+/* general path and uniform integer fast path of pow_ps */
+v4sf stupid_pow_ps(v4sf x) {
+  return pow_ps(x, vaddq_f32(x, vdupq_n_f32(1.25f)));
+}
+
+v4sf stupid_powi_ps(v4sf x) {
+  return pow_ps(x, vdupq_n_f32(3));
+}
+
+float stupid_powf(float x) {
+  return powf(x, x + 1.25f);
+}
+
+float sigmoidf(float x) {
+  return 1 / (1 + expf(-x));
+}
+
+float softplusf(float x) {
+  return log1pf(expf(x));
+}
+
+v4sf stupid_normal_logpdf_ps(v4sf x) {
+  return normal_logpdf_ps(x, vdupq_n_f32(0.25f), 2.f);
+}
+
+float stupid_normal_logpdf_expf(float x) {
+  /* the scalar likelihood it replaces */
+  float z = (x - 0.25f) * 2;
+  return logf(2 * expf(-0.5f * z * z) / 2.50662827f);
+}
+
+float recipf(float x) {
+  return 1 / x;
+}
+
+float stupid_atan2f(float x) {
+  return atan2f(0.75f - x, x - 0.8f);
+}
+
+/* angle wrapping as usually written, on x * 40 so that there are turns
+   to remove */
+float stupid_wrap_pi_fmodf(float x) {
+  float r = fmodf(x*40 + (float)M_PI, 2*(float)M_PI);
+  if (r < 0) r += 2*(float)M_PI;
+  return r - (float)M_PI;
+}
+
+float stupid_wrap_pi_whilef(float x) {
+  float r = x*40;
+  while (r >= (float)M_PI) r -= 2*(float)M_PI;
+  while (r < -(float)M_PI) r += 2*(float)M_PI;
+  return r;
+}
+
 float32x4_t Vtesting_taylor(float32x4_t x){
   const float32x4_t center = vmovq_n_f32(M_PI/6), precomputed_sin = vdupq_n_f32(0.5),precomputed_cos = vdupq_n_f32(0.866025403784);
   v4sf s, c;
@@ -482,6 +1364,25 @@ DECL_SCALAR_FN_BENCH(sinf);
 DECL_SCALAR_FN_BENCH(cosf);
 DECL_SCALAR_FN_BENCH(logf);
 DECL_SCALAR_FN_BENCH(expf);
+DECL_SCALAR_FN_BENCH(exp2f);
+DECL_SCALAR_FN_BENCH(log2f);
+DECL_SCALAR_FN_BENCH(log10f);
+DECL_SCALAR_FN_BENCH(stupid_powf);
+DECL_SCALAR_FN_BENCH(tanhf);
+DECL_SCALAR_FN_BENCH(sigmoidf);
+DECL_SCALAR_FN_BENCH(softplusf);
+DECL_SCALAR_FN_BENCH(erff);
+DECL_SCALAR_FN_BENCH(erfcf);
+DECL_SCALAR_FN_BENCH(stupid_normal_logpdf_expf);
+DECL_SCALAR_FN_BENCH(tanf);
+DECL_SCALAR_FN_BENCH(sqrtf);
+DECL_SCALAR_FN_BENCH(recipf);
+DECL_SCALAR_FN_BENCH(atanf);
+DECL_SCALAR_FN_BENCH(stupid_atan2f);
+DECL_SCALAR_FN_BENCH(stupid_wrap_pi_fmodf);
+DECL_SCALAR_FN_BENCH(stupid_wrap_pi_whilef);
+DECL_SCALAR_FN_BENCH(stupid_asinf);
+DECL_SCALAR_FN_BENCH(stupid_acosf);
 DECL_SCALAR_FN_BENCH(cephes_sinf);
 DECL_SCALAR_FN_BENCH(cephes_cosf);
 DECL_SCALAR_FN_BENCH(cephes_expf);
@@ -491,10 +1392,56 @@ DECL_SCALAR_FN_BENCH(testing_taylor_delta);
 DECL_VECTOR_FN_BENCH(sin_ps);
 DECL_VECTOR_FN_BENCH(cos_ps);
 DECL_VECTOR_FN_BENCH(stupid_sincos_ps);
+DECL_VECTOR_FN_BENCH(stupid_sincos3_ps);
+DECL_VECTOR_FN_BENCH(stupid_sincos5_ps);
+DECL_VECTOR_FN_BENCH(stupid_sincos_bounded_ps);
+DECL_VECTOR_FN_BENCH(stupid_sincos_bounded5_ps);
+DECL_VECTOR_FN_BENCH(stupid_sincos_pio4_ps);
 DECL_VECTOR_FN_BENCH(Vtesting_taylor);
 DECL_VECTOR_FN_BENCH(Vtesting_taylor_delta);
 DECL_VECTOR_FN_BENCH(exp_ps);
 DECL_VECTOR_FN_BENCH(log_ps);
+DECL_VECTOR_FN_BENCH(exp2_ps);
+DECL_VECTOR_FN_BENCH(log2_ps);
+DECL_VECTOR_FN_BENCH(log10_ps);
+DECL_VECTOR_FN_BENCH(stupid_pow_ps);
+DECL_VECTOR_FN_BENCH(stupid_powi_ps);
+DECL_VECTOR_FN_BENCH(tanh_ps);
+DECL_VECTOR_FN_BENCH(sigmoid_ps);
+DECL_VECTOR_FN_BENCH(softplus_ps);
+DECL_VECTOR_FN_BENCH(tanh_fast_ps);
+DECL_VECTOR_FN_BENCH(sigmoid_fast_ps);
+DECL_VECTOR_FN_BENCH(normal_icdf_ps);
+DECL_VECTOR_FN_BENCH(erf_ps);
+DECL_VECTOR_FN_BENCH(erfc_ps);
+DECL_VECTOR_FN_BENCH(normal_cdf_ps);
+DECL_VECTOR_FN_BENCH(normal_pdf_ps);
+DECL_VECTOR_FN_BENCH(stupid_normal_logpdf_ps);
+DECL_VECTOR_FN_BENCH(tan_ps);
+DECL_VECTOR_FN_BENCH(stupid_tan_ps);
+DECL_VECTOR_FN_BENCH(atan_ps);
+DECL_VECTOR_FN_BENCH(stupid_atan2_ps);
+DECL_VECTOR_FN_BENCH(stupid_asin_ps);
+DECL_VECTOR_FN_BENCH(stupid_acos_ps);
+DECL_VECTOR_FN_BENCH(stupid_wrap_pi_ps);
+DECL_VECTOR_FN_BENCH(stupid_wrap_2pi_ps);
+DECL_VECTOR_FN_BENCH(stupid_angle_diff_ps);
+DECL_VECTOR_FN_BENCH(stupid_wrap_180_ps);
+
+/* one wrapper per precision tier, since the bench macros paste the name */
+#define DECL_TIERED_FN_BENCH(fn, expr)                   \
+  v4sf fn##0(v4sf x) { const int S = 0; return expr; }   \
+  v4sf fn##1(v4sf x) { const int S = 1; return expr; }   \
+  v4sf fn##2(v4sf x) { const int S = 2; return expr; }   \
+  DECL_VECTOR_FN_BENCH(fn##0);                           \
+  DECL_VECTOR_FN_BENCH(fn##1);                           \
+  DECL_VECTOR_FN_BENCH(fn##2)
+
+DECL_TIERED_FN_BENCH(Vrsqrt, Vrsqrt<S>(x));
+DECL_TIERED_FN_BENCH(Vsqrt, Vsqrt<S>(x));
+DECL_TIERED_FN_BENCH(Vrecip, Vrecip<S>(x));
+DECL_TIERED_FN_BENCH(Vdiv, Vdiv<S>(vaddq_f32(x, vdupq_n_f32(0.5f)), x));
+DECL_VECTOR_FN_BENCH(V_rsqrt);
 #ifdef HAVE_VECLIB
 DECL_VECTOR_FN_BENCH(vsinf);
 DECL_VECTOR_FN_BENCH(vcosf);
@@ -535,7 +1482,19 @@ int neon_mathfun_test(){
   int err = 0;
   err += check_sincos_precision(0., 1.0);
   err += check_sincos_precision(-1000, 1000);
+  err += check_sincos_tiers(-100, 100);
+  err += check_sincos_bounded();
+  err += check_angle_precision();
   err += check_explog_precision(-60, 60);
+  err += check_normal_icdf_precision();
+  err += check_normal_precision();
+  err += check_tan_precision(-1, 1);
+  err += check_tan_precision(-1000, 1000);
+  err += check_atan_precision(-10, 10);
+  err += check_atan_precision(-1e6, 1e6);
+  err += check_asin_precision();
+  err += check_sqrt_precision();
+  err += check_activation_precision(-20, 20);
 
   if (err) {
     printf("some precision tests have failed\n");
@@ -549,6 +1508,25 @@ int neon_mathfun_test(){
 #endif
   run_bench("expf", bench_expf);
   run_bench("logf", bench_logf);
+  run_bench("exp2f", bench_exp2f);
+  run_bench("log2f", bench_log2f);
+  run_bench("log10f", bench_log10f);
+  run_bench("powf", bench_stupid_powf);
+  run_bench("tanhf", bench_tanhf);
+  run_bench("sigmoid (expf)", bench_sigmoidf);
+  run_bench("softplus (expf)", bench_softplusf);
+  run_bench("erff", bench_erff);
+  run_bench("erfcf", bench_erfcf);
+  run_bench("log(normal pdf) (expf)", bench_stupid_normal_logpdf_expf);
+  run_bench("tanf", bench_tanf);
+  run_bench("sqrtf", bench_sqrtf);
+  run_bench("1/x", bench_recipf);
+  run_bench("atanf", bench_atanf);
+  run_bench("atan2f", bench_stupid_atan2f);
+  run_bench("asinf", bench_stupid_asinf);
+  run_bench("acosf", bench_stupid_acosf);
+  run_bench("wrap pi (fmodf)", bench_stupid_wrap_pi_fmodf);
+  run_bench("wrap pi (while)", bench_stupid_wrap_pi_whilef);
 
   run_bench("cephes_sinf", bench_cephes_sinf);
   run_bench("cephes_cosf", bench_cephes_cosf);
@@ -560,10 +1538,54 @@ int neon_mathfun_test(){
   run_bench("sin_ps", bench_sin_ps);
   run_bench("cos_ps", bench_cos_ps);
   run_bench("sincos_ps", bench_stupid_sincos_ps);
+  run_bench("sincos_ps<3>", bench_stupid_sincos3_ps);
+  run_bench("sincos_ps<5>", bench_stupid_sincos5_ps);
+  run_bench("sincos_ps_bounded", bench_stupid_sincos_bounded_ps);
+  run_bench("sincos_ps_bounded<5>", bench_stupid_sincos_bounded5_ps);
+  run_bench("sincos_ps_pio4", bench_stupid_sincos_pio4_ps);
   run_bench("Vtesting_taylor", bench_Vtesting_taylor);
   run_bench("Vtesting_taylor_delta", bench_Vtesting_taylor_delta);
   run_bench("exp_ps", bench_exp_ps);
   run_bench("log_ps", bench_log_ps);
+  run_bench("exp2_ps", bench_exp2_ps);
+  run_bench("log2_ps", bench_log2_ps);
+  run_bench("log10_ps", bench_log10_ps);
+  run_bench("pow_ps", bench_stupid_pow_ps);
+  run_bench("pow_ps (x^3)", bench_stupid_powi_ps);
+  run_bench("tanh_ps", bench_tanh_ps);
+  run_bench("sigmoid_ps", bench_sigmoid_ps);
+  run_bench("softplus_ps", bench_softplus_ps);
+  run_bench("tanh_fast_ps", bench_tanh_fast_ps);
+  run_bench("sigmoid_fast_ps", bench_sigmoid_fast_ps);
+  run_bench("normal_icdf_ps", bench_normal_icdf_ps);
+  run_bench("erf_ps", bench_erf_ps);
+  run_bench("erfc_ps", bench_erfc_ps);
+  run_bench("normal_cdf_ps", bench_normal_cdf_ps);
+  run_bench("normal_pdf_ps", bench_normal_pdf_ps);
+  run_bench("normal_logpdf_ps", bench_stupid_normal_logpdf_ps);
+  run_bench("tan_ps", bench_tan_ps);
+  run_bench("sincos_ps + div", bench_stupid_tan_ps);
+  run_bench("atan_ps", bench_atan_ps);
+  run_bench("atan2_ps", bench_stupid_atan2_ps);
+  run_bench("asin_ps", bench_stupid_asin_ps);
+  run_bench("acos_ps", bench_stupid_acos_ps);
+  run_bench("wrap_pi_ps", bench_stupid_wrap_pi_ps);
+  run_bench("wrap_2pi_ps", bench_stupid_wrap_2pi_ps);
+  run_bench("angle_diff_ps", bench_stupid_angle_diff_ps);
+  run_bench("wrap_180_ps", bench_stupid_wrap_180_ps);
+  run_bench("V_rsqrt (Quake)", bench_V_rsqrt);
+  run_bench("Vrsqrt<0>", bench_Vrsqrt0);
+  run_bench("Vrsqrt<1>", bench_Vrsqrt1);
+  run_bench("Vrsqrt<2>", bench_Vrsqrt2);
+  run_bench("Vsqrt<0>", bench_Vsqrt0);
+  run_bench("Vsqrt<1>", bench_Vsqrt1);
+  run_bench("Vsqrt<2>", bench_Vsqrt2);
+  run_bench("Vrecip<0>", bench_Vrecip0);
+  run_bench("Vrecip<1>", bench_Vrecip1);
+  run_bench("Vrecip<2>", bench_Vrecip2);
+  run_bench("Vdiv<0>", bench_Vdiv0);
+  run_bench("Vdiv<1>", bench_Vdiv1);
+  run_bench("Vdiv<2>", bench_Vdiv2);
 
 #ifdef HAVE_VECLIB
   run_bench("vsinf", bench_vsinf);
@@ -124,6 +124,21 @@ int bench_one_double_Vfloat() {
     return 1;
 }
 
+#define SPLIT_BLOCK 1000
+
+int bench_split_Vfloat() {
+    // one child stream per block, as a library spawning per-object streams
+    // would do
+    Vuniform_float32_t parent(TEST_FLOAT_MIN, TEST_FLOAT_MAX, 2000);
+    for (int i = 0; i < xoroshiro_N; i += SPLIT_BLOCK) {
+        Vuniform_float32_t child = parent.split();
+        for (int j = 0; j < SPLIT_BLOCK; j += 4) {
+            vst1q_f32(output + i + j, child());
+        }
+    }
+    return 1;
+}
+
 int bench_int() {
     // test non - vectorized ints
     Xoroshiro128plus rng(2000);
@@ -165,6 +180,20 @@ bool int_validator(){
     return true;
 }
 
+bool split_validator(){
+    // the child streams must all differ, and splitting again from the same
+    // seed must give the same streams
+    for(int i = SPLIT_BLOCK;i < xoroshiro_N;i += SPLIT_BLOCK){
+        for(int j = 0;j < i;j += SPLIT_BLOCK){
+            if(output[i] == output[j]) return false;
+        }
+    }
+    Vuniform_float32_t parent(TEST_FLOAT_MIN, TEST_FLOAT_MAX, 2000);
+    Vuniform_float32_t first = parent.split();
+    if(vgetq_lane_f32(first(), 0) != output[0]) return false;
+    return float_validator();
+}
+
 bool multiple_validator(){
     return true;
 }
@@ -318,6 +347,7 @@ void xoroshiro128_test() {
     run_xoshiro_bench("vector uniform float", bench_Vfloat,float_validator,float_dist_display);
     run_xoshiro_bench("vector uniform doubleNext float", bench_doubleNext_Vfloat,float_validator,float_dist_display);
     run_xoshiro_bench("vector uniform int", bench_Vint,int_validator,int_dist_display);
+    run_xoshiro_bench("vector uniform float split streams", bench_split_Vfloat,split_validator,float_dist_display);
 
     run_xoshiro_bench("vector diff_float multiple", bench_multiple_Vfloat,multiple_validator,float_dist_display);
     run_xoshiro_bench("vector diff_float one", bench_one_Vfloat,multiple_validator,float_dist_display);
@@ -0,0 +1,293 @@
+#include "tests/ziggurat_test.hpp"
+#include "api.h"
+#include "vexmath/distributions/box_muller.hpp"
+#include "vexmath/distributions/wallace.hpp"
+#include "vexmath/pmu.hpp"
+#include "vexmath/ziggurat/normal.hpp"
+#include <math.h>
+#include <random>
+#include <stdio.h>
+
+const int ziggurat_N = 50000;
+
+float ziggurat_output[ziggurat_N];
+
+template<uint32_t Layers>
+int bench_normal() {
+    static math::ziggurat::ZigguratPRNG<Layers> gen(2000);
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = gen.normal();
+    }
+    return 1;
+}
+
+template<uint32_t Layers>
+int bench_exponential() {
+    static math::ziggurat::ZigguratPRNG<Layers> gen(2000);
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = gen.exponential();
+    }
+    return 1;
+}
+
+int bench_box_muller() {
+    static math::distributions::VBoxMuller gen(2000);
+    gen.fill(ziggurat_output, ziggurat_N);
+    return 1;
+}
+
+int bench_wallace() {
+    static math::distributions::WallacePRNG<> gen(2000);
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = gen.normal();
+    }
+    return 1;
+}
+
+int bench_wallace_fill() {
+    static math::distributions::WallacePRNG<> gen(2000);
+    gen.fill(ziggurat_output, ziggurat_N);
+    return 1;
+}
+
+int bench_wallace_exponential() {
+    static math::distributions::WallacePRNG<> gen(2000);
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = gen.exponential();
+    }
+    return 1;
+}
+
+int bench_std_normal() {
+    static Xoroshiro128plus rng(2000);
+    std::normal_distribution<float> dist(0, 1);
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = dist(rng);
+    }
+    return 1;
+}
+
+int bench_std_exponential() {
+    static Xoroshiro128plus rng(2000);
+    std::exponential_distribution<float> dist(1);
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = dist(rng);
+    }
+    return 1;
+}
+
+// checks the first two moments of the last generated batch
+bool normal_validator() {
+    double mean = 0, var = 0;
+    for (int i = 0; i < ziggurat_N; i++) {
+        mean += ziggurat_output[i];
+        var += ziggurat_output[i] * ziggurat_output[i];
+    }
+    mean /= ziggurat_N;
+    var = var / ziggurat_N - mean * mean;
+    return fabs(mean) < 0.05 && fabs(var - 1) < 0.05;
+}
+
+// moments plus the kurtosis and the mass beyond 3 standard deviations, which
+// catch a pool generator whose sum of squares is not corrected
+bool normal_tail_validator() {
+    double m4 = 0;
+    int tail = 0;
+    for (int i = 0; i < ziggurat_N; i++) {
+        double x2 = ziggurat_output[i] * ziggurat_output[i];
+        m4 += x2 * x2;
+        if (x2 > 9) tail++;
+    }
+    m4 /= ziggurat_N;
+    return normal_validator() && fabs(m4 - 3) < 0.15 &&
+           fabs(tail / (double)ziggurat_N - 0.0027) < 0.001;
+}
+
+bool exponential_validator() {
+    double mean = 0;
+    for (int i = 0; i < ziggurat_N; i++) {
+        if (ziggurat_output[i] < 0) return false;
+        mean += ziggurat_output[i];
+    }
+    mean /= ziggurat_N;
+    return fabs(mean - 1) < 0.05;
+}
+
+// the scale of a Wallace block must not depend on the previous block: the
+// first output of each block against the sum of squares of the next one
+bool wallace_validator() {
+    const int blocks = 4000, pool = 64;
+    math::distributions::WallacePRNG<pool> gen(2000);
+    double sx = 0, sy = 0, sxx = 0, syy = 0, sxy = 0;
+    for (int b = 0; b < blocks; b++) {
+        /* pairs of consecutive blocks */
+        float first = gen.normal();
+        for (int i = 1; i < pool; i++) gen.normal();
+        double squares = 0;
+        for (int i = 0; i < pool; i++) {
+            float x = gen.normal();
+            squares += x * x;
+        }
+        sx += first;
+        sy += squares;
+        sxx += first * first;
+        syy += squares * squares;
+        sxy += first * squares;
+    }
+    sx /= blocks, sy /= blocks;
+    double corr = (sxy / blocks - sx * sy) / sqrt((sxx / blocks - sx * sx) * (syy / blocks - sy * sy));
+    return normal_tail_validator() && fabs(corr) < 0.1;
+}
+
+void run_ziggurat_bench(const char* s, int (*fn)(), bool (*validator)()) {
+    printf("benching %40s ..", s);
+    fflush(stdout);
+    int32_t it0 = pros::micros(), it1;
+    double iter = 0;
+    // avoid variations due time of pros::micros
+    for (long long i = 0; i < 200; i++) {
+        iter += fn();
+        i++;
+    }
+    it1 = pros::micros();
+    double micro_t0 = (double)it0, micro_t1 = (double)it1;
+
+    double d_microsec = ((micro_t1 - micro_t0) / ((double)iter));
+    double d_millisec = d_microsec / 1000.0;
+    double numbers_microsec = ziggurat_N / d_microsec;
+
+    // verify output is valid
+    bool valid = validator();
+    if (!valid) {
+        printf(" -> failed validity tests!");
+    }
+
+    printf(
+      " -> %d elements in %3.2f milliseconds -> %3.2f numbers/microsecond\n",
+      ziggurat_N,
+      d_millisec,
+      numbers_microsec);
+}
+
+template<uint32_t Layers>
+void print_layer_info() {
+    constexpr auto& norm = math::ziggurat::normal_layers<Layers>;
+    constexpr auto& exp = math::ziggurat::exponential_layers<Layers>;
+    printf("%4lu layers: normal early exit %5.2f%% (%u table bytes), "
+           "exponential early exit %5.2f%% (%u table bytes)\n",
+           (unsigned long)Layers,
+           100.0 * norm.bins / Layers,
+           (unsigned)sizeof(norm),
+           100.0 * exp.bins / Layers,
+           (unsigned)sizeof(exp));
+}
+
+// Cold cache benchmark: a control loop draws a few numbers per iteration and
+// touches a lot of other memory in between, so the tables are usually evicted
+// from L1 by the time the next draw happens.
+const int cold_sweep_floats = 64 * 1024; // 256KB, 8 times the L1D
+const int cold_rounds = 2000;
+const int cold_draws = 4;
+
+float cold_sweep[cold_sweep_floats];
+volatile float cold_sink; // keeps the draws from being optimized out
+
+float sweep_cache() {
+    float sum = 0;
+    for (int i = 0; i < cold_sweep_floats; i += 8) { // one float per line
+        cold_sweep[i] += 1;
+        sum += cold_sweep[i];
+    }
+    return sum;
+}
+
+template<typename Generator, typename Draw>
+void run_cold_bench(const char* s, Generator& gen, Draw draw) {
+    printf("cold cache %40s ..", s);
+    fflush(stdout);
+    pmu::enable(pmu::L1D_REFILL);
+    uint64_t total_cycles = 0, total_refills = 0;
+    uint32_t worst_cycles = 0;
+    for (int r = 0; r < cold_rounds; r++) {
+        cold_sink = sweep_cache();
+        for (int d = 0; d < cold_draws; d++) {
+            uint32_t c0 = pmu::cycles(), e0 = pmu::events();
+            cold_sink = draw(gen);
+            uint32_t c1 = pmu::cycles(), e1 = pmu::events();
+            total_cycles += c1 - c0;
+            total_refills += e1 - e0;
+            if (c1 - c0 > worst_cycles) worst_cycles = c1 - c0;
+        }
+    }
+    const double n = (double)cold_rounds * cold_draws;
+    printf(" -> %6.1f cycles/draw avg, %6lu worst, %4.2f L1D refills/draw\n",
+           total_cycles / n,
+           (unsigned long)worst_cycles,
+           total_refills / n);
+}
+
+template<template<typename, uint32_t> class Tables>
+void cold_bench_layout(const char* normal_name, const char* exponential_name) {
+    static math::ziggurat::ZigguratPRNG<256, Tables> gen(2000);
+    run_cold_bench(normal_name, gen, [](auto& g) { return g.normal(); });
+    run_cold_bench(exponential_name, gen, [](auto& g) { return g.exponential(); });
+}
+
+// Path counters and per call latency of the instrumented generator, the
+// counts are checked against the early exit rates built into the tables
+void run_instrumented() {
+    using namespace math::ziggurat;
+    static InstrumentedNormalPRNG gen(2000);
+    gen.stats.reset();
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = gen.normal();
+    }
+    bool valid = normal_validator();
+    for (int i = 0; i < ziggurat_N; i++) {
+        ziggurat_output[i] = gen.exponential();
+    }
+    valid = valid && exponential_validator();
+
+    const auto& hits = gen.stats.hits;
+    double normal_early = hits[(int)ziggurat_path::normal_early_exit] / (double)ziggurat_N;
+    double expected = normal_layers<256>.bins / 256.0;
+    if (!valid || fabs(normal_early - expected) > 0.01) {
+        printf("instrumented ziggurat -> failed validity tests!\n");
+    }
+    gen.stats.print();
+}
+
+void ziggurat_test() {
+    printf("---------------------\n");
+    printf("running ziggurat benchmarks\n");
+    print_layer_info<64>();
+    print_layer_info<128>();
+    print_layer_info<256>();
+    print_layer_info<1024>();
+
+    run_ziggurat_bench("std::normal_distribution", bench_std_normal, normal_validator);
+    run_ziggurat_bench("normal (64 layers)", bench_normal<64>, normal_validator);
+    run_ziggurat_bench("normal (128 layers)", bench_normal<128>, normal_validator);
+    run_ziggurat_bench("normal (256 layers)", bench_normal<256>, normal_validator);
+    run_ziggurat_bench("normal (1024 layers)", bench_normal<1024>, normal_validator);
+    run_ziggurat_bench("VBoxMuller fill", bench_box_muller, normal_validator);
+    run_ziggurat_bench("Wallace (1024 pool)", bench_wallace, wallace_validator);
+    run_ziggurat_bench("Wallace fill (1024 pool)", bench_wallace_fill, normal_tail_validator);
+
+    run_ziggurat_bench("std::exponential_distribution", bench_std_exponential, exponential_validator);
+    run_ziggurat_bench("exponential (64 layers)", bench_exponential<64>, exponential_validator);
+    run_ziggurat_bench("exponential (128 layers)", bench_exponential<128>, exponential_validator);
+    run_ziggurat_bench("exponential (256 layers)", bench_exponential<256>, exponential_validator);
+    run_ziggurat_bench("exponential (1024 layers)", bench_exponential<1024>, exponential_validator);
+    run_ziggurat_bench("Wallace exponential (1024 pool)", bench_wallace_exponential, exponential_validator);
+
+    cold_bench_layout<math::ziggurat::separate_tables>("normal (separate tables)",
+                                                       "exponential (separate tables)");
+    cold_bench_layout<math::ziggurat::interleaved_tables>("normal (interleaved tables)",
+                                                          "exponential (interleaved tables)");
+    static math::distributions::WallacePRNG<> wallace(2000);
+    run_cold_bench("normal (Wallace 1024 pool)", wallace, [](auto& g) { return g.normal(); });
+
+    run_instrumented();
+    printf("---------------------\n");
+}